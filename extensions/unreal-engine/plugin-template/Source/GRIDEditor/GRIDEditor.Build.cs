@@ -1,5 +1,6 @@
 // Copyright 2025 GRID. All Rights Reserved.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class GRIDEditor : ModuleRules
@@ -49,6 +50,9 @@ public class GRIDEditor : ModuleRules
 			}
 		);
 
+		// FGRIDSocketPoller hands native BSD socket handles to epoll, poll or WSAPoll
+		PrivateIncludePaths.Add(Path.Combine(EngineDirectory, "Source", "Runtime", "Sockets", "Private"));
+
 		if (Target.bBuildEditor == true)
 		{
 			PrivateDependencyModuleNames.AddRange(
@@ -1,13 +1,52 @@
 // Copyright 2025 GRID. All Rights Reserved.
 
 #include "Commands/ActorCommands.h"
+#include "GRIDBridge.h"
+#include "Core/ToolRegistry.h"
+#include "Core/ObjectCache.h"
 #include "Engine/World.h"
+#include "Engine/Level.h"
 #include "Engine/StaticMeshActor.h"
 #include "GameFramework/Actor.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Editor.h"
 #include "LevelEditor.h"
+#include "ConvexVolume.h"
+
+namespace
+{
+	/** Read a {"x", "y", "z"} object param */
+	bool TryGetVectorField(const TSharedPtr<FJsonObject>& Params, const TCHAR* Field, FVector& OutVector)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		return Params->TryGetObjectField(Field, Object)
+			&& (*Object)->TryGetNumberField(TEXT("x"), OutVector.X)
+			&& (*Object)->TryGetNumberField(TEXT("y"), OutVector.Y)
+			&& (*Object)->TryGetNumberField(TEXT("z"), OutVector.Z);
+	}
+
+	/** A perspective view volume; planes face outward, as FConvexVolume expects */
+	FConvexVolume MakeViewFrustum(const FVector& Origin, const FRotator& Rotation, double FovDegrees, double Aspect, double NearDistance, double FarDistance)
+	{
+		const FRotationMatrix Axes(Rotation);
+		const FVector Forward = Axes.GetUnitAxis(EAxis::X);
+		const FVector Right = Axes.GetUnitAxis(EAxis::Y);
+		const FVector Up = Axes.GetUnitAxis(EAxis::Z);
+
+		const double HalfWidth = FMath::DegreesToRadians(FMath::Clamp(FovDegrees, 1.0, 179.0) * 0.5);
+		const double HalfHeight = FMath::Atan(FMath::Tan(HalfWidth) / FMath::Max(Aspect, UE_KINDA_SMALL_NUMBER));
+
+		TArray<FPlane, TInlineAllocator<6>> Planes;
+		Planes.Emplace(Origin + Forward * NearDistance, -Forward);
+		Planes.Emplace(Origin + Forward * FarDistance, Forward);
+		Planes.Emplace(Origin, Right * FMath::Cos(HalfWidth) - Forward * FMath::Sin(HalfWidth));
+		Planes.Emplace(Origin, -Right * FMath::Cos(HalfWidth) - Forward * FMath::Sin(HalfWidth));
+		Planes.Emplace(Origin, Up * FMath::Cos(HalfHeight) - Forward * FMath::Sin(HalfHeight));
+		Planes.Emplace(Origin, -Up * FMath::Cos(HalfHeight) - Forward * FMath::Sin(HalfHeight));
+		return FConvexVolume(Planes);
+	}
+}
 
 FActorCommands::FActorCommands()
 {
@@ -17,85 +56,214 @@ FActorCommands::~FActorCommands()
 {
 }
 
-TSharedPtr<FJsonObject> FActorCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FActorCommands::RegisterCommands(FGRIDToolRegistry& Registry)
 {
-	if (CommandType == TEXT("actor_list"))
-	{
-		return ListActors(Params);
-	}
-	else if (CommandType == TEXT("actor_find"))
-	{
-		return FindActors(Params);
-	}
-	else if (CommandType == TEXT("actor_spawn"))
-	{
-		return SpawnActor(Params);
-	}
-	else if (CommandType == TEXT("actor_delete"))
-	{
-		return DeleteActor(Params);
-	}
-	else if (CommandType == TEXT("actor_get_info"))
+	Registry.RegisterCommand(this, TEXT("actor_list"), &FActorCommands::ListActors, TEXT("Actor"), TEXT("List actors in the editor world, a page at a time"),
+		EGRIDThreadAffinity::GameThread,
+		GRID_TOOL_PARAMS(
+			GRID_TOOL_PARAM("limit", "Actors per page; all by default", "int", false),
+			GRID_TOOL_PARAM("cursor", "next_cursor from the previous page", "string", false),
+			GRID_TOOL_PARAM("stream", "Send every page as it is produced", "bool", false)));
+	Registry.RegisterCommand(this, TEXT("actor_find"), &FActorCommands::FindActors, TEXT("Actor"), TEXT("Find actors by label, class or tag"),
+		EGRIDThreadAffinity::GameThread,
+		GRID_TOOL_PARAMS(
+			GRID_TOOL_PARAM("name", "Exact actor label, ignoring case", "string", false),
+			GRID_TOOL_PARAM("pattern", "Substring of the actor label", "string", false),
+			GRID_TOOL_PARAM("class", "Exact class name", "string", false),
+			GRID_TOOL_PARAM("tag", "Actor tag", "string", false)));
+	Registry.RegisterCommand(this, TEXT("actor_query_region"), &FActorCommands::QueryRegion, TEXT("Actor"), TEXT("Find actors whose bounds fall in a sphere, box or view frustum, or nearest to a point"),
+		EGRIDThreadAffinity::GameThread,
+		GRID_TOOL_PARAMS(
+			GRID_TOOL_PARAM("shape", "sphere, box, frustum or nearest", "string", true),
+			GRID_TOOL_PARAM("center", "{x, y, z} for sphere and nearest", "object", false),
+			GRID_TOOL_PARAM("radius", "Sphere radius", "number", false),
+			GRID_TOOL_PARAM("min", "{x, y, z} lower box corner", "object", false),
+			GRID_TOOL_PARAM("max", "{x, y, z} upper box corner", "object", false),
+			GRID_TOOL_PARAM("origin", "{x, y, z} frustum apex", "object", false),
+			GRID_TOOL_PARAM("rotation", "{pitch, yaw, roll} frustum direction in degrees", "object", false),
+			GRID_TOOL_PARAM("fov", "Horizontal field of view in degrees; 90 by default", "number", false),
+			GRID_TOOL_PARAM("aspect", "Width over height; 16:9 by default", "number", false),
+			GRID_TOOL_PARAM("near", "Near plane distance; 10 by default", "number", false),
+			GRID_TOOL_PARAM("far", "Far plane distance; 100000 by default", "number", false),
+			GRID_TOOL_PARAM("count", "Actors returned by nearest; 10 by default", "int", false),
+			GRID_TOOL_PARAM("max_distance", "Ignore actors further than this for nearest", "number", false),
+			GRID_TOOL_PARAM("class", "Only actors of this exact class", "string", false)));
+	Registry.RegisterCommand(this, TEXT("actor_spawn"), &FActorCommands::SpawnActor, TEXT("Actor"), TEXT("Spawn an actor in the editor world"));
+	Registry.RegisterCommand(this, TEXT("actor_delete"), &FActorCommands::DeleteActor, TEXT("Actor"), TEXT("Delete an actor"));
+	Registry.RegisterCommand(this, TEXT("actor_get_info"), &FActorCommands::GetActorInfo, TEXT("Actor"), TEXT("Get an actor's class, transform and components"));
+	Registry.RegisterCommand(this, TEXT("actor_get_transform"), &FActorCommands::GetTransform, TEXT("Actor"), TEXT("Get an actor's transform"));
+	Registry.RegisterCommand(this, TEXT("actor_set_transform"), &FActorCommands::SetTransform, TEXT("Actor"), TEXT("Set an actor's transform"));
+	Registry.RegisterCommand(this, TEXT("actor_set_location"), &FActorCommands::SetLocation, TEXT("Actor"), TEXT("Set an actor's location"));
+	Registry.RegisterCommand(this, TEXT("actor_set_rotation"), &FActorCommands::SetRotation, TEXT("Actor"), TEXT("Set an actor's rotation"));
+	Registry.RegisterCommand(this, TEXT("actor_set_scale"), &FActorCommands::SetScale, TEXT("Actor"), TEXT("Set an actor's scale"));
+	Registry.RegisterCommand(this, TEXT("actor_focus"), &FActorCommands::FocusActor, TEXT("Actor"), TEXT("Focus the viewport on an actor"));
+	Registry.RegisterCommand(this, TEXT("actor_select"), &FActorCommands::SelectActor, TEXT("Actor"), TEXT("Select an actor in the editor"));
+	Registry.RegisterCommand(this, TEXT("actor_rename"), &FActorCommands::RenameActor, TEXT("Actor"), TEXT("Rename an actor's label"));
+}
+
+TSharedPtr<FJsonObject> FActorCommands::ListActors(const TSharedPtr<FJsonObject>& Params)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
 	{
-		return GetActorInfo(Params);
+		return FGRIDBridge::CreateErrorResponse(TEXT("NO_WORLD"), TEXT("No active world"));
 	}
-	else if (CommandType == TEXT("actor_get_transform"))
+
+	// A cursor resumes the snapshot taken for the first page; otherwise list the world by level, then name
+	TSharedPtr<const TArray<TWeakObjectPtr<AActor>>> Snapshot;
+	FGuid SnapshotId;
+	int32 Start = 0;
+	FString Cursor;
+	if (Params->TryGetStringField(TEXT("cursor"), Cursor))
 	{
-		return GetTransform(Params);
+		Snapshot = ActorCursors.Resume(Cursor, SnapshotId, Start);
+		if (!Snapshot.IsValid())
+		{
+			return FGRIDBridge::CreateErrorResponse(TEXT("INVALID_CURSOR"), TEXT("Cursor is malformed or has expired; request the first page again"));
+		}
 	}
-	else if (CommandType == TEXT("actor_set_transform"))
+	else
 	{
-		return SetTransform(Params);
+		// Sort on cheap keys: a path string per level, none per actor
+		TArray<TPair<FString, const ULevel*>> Levels;
+		for (const ULevel* Level : World->GetLevels())
+		{
+			if (Level)
+			{
+				Levels.Emplace(Level->GetPathName(), Level);
+			}
+		}
+		Levels.Sort([](const TPair<FString, const ULevel*>& A, const TPair<FString, const ULevel*>& B) { return A.Key < B.Key; });
+
+		TMap<const ULevel*, int32> LevelRanks;
+		for (int32 Rank = 0; Rank < Levels.Num(); Rank++)
+		{
+			LevelRanks.Add(Levels[Rank].Value, Rank);
+		}
+
+		struct FActorKey
+		{
+			int32 LevelRank;
+			FName Name;
+			AActor* Actor;
+		};
+		TArray<FActorKey> Ordered;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			const int32* Rank = LevelRanks.Find(It->GetLevel());
+			Ordered.Add({ Rank ? *Rank : Levels.Num(), It->GetFName(), *It });
+		}
+		Ordered.Sort([](const FActorKey& A, const FActorKey& B)
+		{
+			return A.LevelRank != B.LevelRank ? A.LevelRank < B.LevelRank : A.Name.Compare(B.Name) < 0;
+		});
+
+		TArray<TWeakObjectPtr<AActor>> Actors;
+		Actors.Reserve(Ordered.Num());
+		for (const FActorKey& Entry : Ordered)
+		{
+			Actors.Add(Entry.Actor);
+		}
+		Snapshot = MakeShared<const TArray<TWeakObjectPtr<AActor>>>(MoveTemp(Actors));
 	}
-	else if (CommandType == TEXT("actor_set_location"))
+
+	int32 Limit = Snapshot->Num();
+	Params->TryGetNumberField(TEXT("limit"), Limit);
+	const int32 End = Start + FMath::Min(FMath::Max(Limit, 1), Snapshot->Num() - Start);
+
+	TArray<TSharedPtr<FJsonValue>> ActorArray;
+	for (int32 Index = Start; Index < End; Index++)
 	{
-		return SetLocation(Params);
+		// Actors deleted since the snapshot was taken are skipped
+		AActor* Actor = (*Snapshot)[Index].Get();
+		if (!Actor)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+		ActorObj->SetStringField(TEXT("name"), Actor->GetActorLabel());
+		ActorObj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+
+		FVector Location = Actor->GetActorLocation();
+		ActorObj->SetNumberField(TEXT("x"), Location.X);
+		ActorObj->SetNumberField(TEXT("y"), Location.Y);
+		ActorObj->SetNumberField(TEXT("z"), Location.Z);
+
+		ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
 	}
-	else if (CommandType == TEXT("actor_set_rotation"))
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetArrayField(TEXT("actors"), ActorArray);
+	Data->SetNumberField(TEXT("count"), ActorArray.Num());
+	Data->SetNumberField(TEXT("total"), Snapshot->Num());
+
+	const FString NextCursor = ActorCursors.Continue(SnapshotId, Snapshot.ToSharedRef(), End);
+	if (!NextCursor.IsEmpty())
 	{
-		return SetRotation(Params);
+		Data->SetStringField(TEXT("next_cursor"), NextCursor);
 	}
-	else if (CommandType == TEXT("actor_set_scale"))
+
+	return FGRIDBridge::CreateSuccessResponse(Data);
+}
+
+TSharedPtr<FJsonObject> FActorCommands::FindActors(const TSharedPtr<FJsonObject>& Params)
+{
+	FString Name;
+	FString Pattern;
+	FString ClassName;
+	FString Tag;
+	Params->TryGetStringField(TEXT("name"), Name);
+	Params->TryGetStringField(TEXT("pattern"), Pattern);
+	Params->TryGetStringField(TEXT("class"), ClassName);
+	Params->TryGetStringField(TEXT("tag"), Tag);
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
 	{
-		return SetScale(Params);
+		return FGRIDBridge::CreateErrorResponse(TEXT("NO_WORLD"), TEXT("No active world"));
 	}
-	else if (CommandType == TEXT("actor_focus"))
+
+	// The most selective exact key is looked up in the index; the other filters check only its bucket
+	TArray<AActor*> Candidates;
+	if (!Name.IsEmpty())
 	{
-		return FocusActor(Params);
+		ActorIndex.FindByLabel(World, Name, Candidates);
 	}
-	else if (CommandType == TEXT("actor_select"))
+	else if (!ClassName.IsEmpty())
 	{
-		return SelectActor(Params);
+		ActorIndex.FindByClass(World, FName(*ClassName), Candidates);
 	}
-	else if (CommandType == TEXT("actor_rename"))
+	else if (!Tag.IsEmpty())
 	{
-		return RenameActor(Params);
+		ActorIndex.FindByTag(World, FName(*Tag), Candidates);
 	}
-
-	return CreateError(TEXT("UNKNOWN_COMMAND"), FString::Printf(TEXT("Unknown actor command: %s"), *CommandType));
-}
-
-TSharedPtr<FJsonObject> FActorCommands::ListActors(const TSharedPtr<FJsonObject>& Params)
-{
-	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-	if (!World)
+	else
 	{
-		return CreateError(TEXT("NO_WORLD"), TEXT("No active world"));
+		ActorIndex.ForEach(World, [&Candidates, &Pattern](AActor* Actor, const FString& Label)
+		{
+			if (Label.Contains(Pattern))
+			{
+				Candidates.Add(Actor);
+			}
+			return true;
+		});
 	}
 
 	TArray<TSharedPtr<FJsonValue>> ActorArray;
-	for (TActorIterator<AActor> It(World); It; ++It)
+	for (AActor* Actor : Candidates)
 	{
-		AActor* Actor = *It;
+		const FString Label = Actor->GetActorLabel();
+		if ((!Pattern.IsEmpty() && !Label.Contains(Pattern))
+			|| (!ClassName.IsEmpty() && Actor->GetClass()->GetName() != ClassName)
+			|| (!Tag.IsEmpty() && !Actor->ActorHasTag(FName(*Tag))))
+		{
+			continue;
+		}
+
 		TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
-		ActorObj->SetStringField(TEXT("name"), Actor->GetActorLabel());
+		ActorObj->SetStringField(TEXT("name"), Label);
 		ActorObj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-
-		FVector Location = Actor->GetActorLocation();
-		ActorObj->SetNumberField(TEXT("x"), Location.X);
-		ActorObj->SetNumberField(TEXT("y"), Location.Y);
-		ActorObj->SetNumberField(TEXT("z"), Location.Z);
-
 		ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
 	}
 
@@ -103,49 +271,135 @@ TSharedPtr<FJsonObject> FActorCommands::ListActors(const TSharedPtr<FJsonObject>
 	Data->SetArrayField(TEXT("actors"), ActorArray);
 	Data->SetNumberField(TEXT("count"), ActorArray.Num());
 
-	return CreateSuccess(Data);
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
-TSharedPtr<FJsonObject> FActorCommands::FindActors(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FActorCommands::QueryRegion(const TSharedPtr<FJsonObject>& Params)
 {
-	FString Pattern = Params->GetStringField(TEXT("pattern"));
-	FString ClassName = Params->GetStringField(TEXT("class"));
+	FString Shape;
+	if (!Params->TryGetStringField(TEXT("shape"), Shape))
+	{
+		return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("Missing 'shape'"));
+	}
 
 	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 	if (!World)
 	{
-		return CreateError(TEXT("NO_WORLD"), TEXT("No active world"));
+		return FGRIDBridge::CreateErrorResponse(TEXT("NO_WORLD"), TEXT("No active world"));
 	}
 
-	TArray<TSharedPtr<FJsonValue>> ActorArray;
-	for (TActorIterator<AActor> It(World); It; ++It)
+	// Distance is only reported by nearest, which returns its matches closest first
+	TArray<TPair<AActor*, double>> Matches;
+	TArray<AActor*> Actors;
+	if (Shape == TEXT("sphere"))
+	{
+		FVector Center;
+		double Radius = 0.0;
+		if (!TryGetVectorField(Params, TEXT("center"), Center) || !Params->TryGetNumberField(TEXT("radius"), Radius))
+		{
+			return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("sphere requires 'center' and 'radius'"));
+		}
+		ActorIndex.QuerySphere(World, Center, Radius, Actors);
+	}
+	else if (Shape == TEXT("box"))
+	{
+		FVector Min;
+		FVector Max;
+		if (!TryGetVectorField(Params, TEXT("min"), Min) || !TryGetVectorField(Params, TEXT("max"), Max))
+		{
+			return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("box requires 'min' and 'max'"));
+		}
+		ActorIndex.QueryBox(World, FBox(Min.ComponentMin(Max), Min.ComponentMax(Max)), Actors);
+	}
+	else if (Shape == TEXT("frustum"))
+	{
+		FVector Origin;
+		const TSharedPtr<FJsonObject>* RotationObj;
+		if (!TryGetVectorField(Params, TEXT("origin"), Origin) || !Params->TryGetObjectField(TEXT("rotation"), RotationObj))
+		{
+			return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("frustum requires 'origin' and 'rotation'"));
+		}
+
+		FRotator Rotation = FRotator::ZeroRotator;
+		(*RotationObj)->TryGetNumberField(TEXT("pitch"), Rotation.Pitch);
+		(*RotationObj)->TryGetNumberField(TEXT("yaw"), Rotation.Yaw);
+		(*RotationObj)->TryGetNumberField(TEXT("roll"), Rotation.Roll);
+
+		double Fov = 90.0;
+		double Aspect = 16.0 / 9.0;
+		double NearDistance = 10.0;
+		double FarDistance = 100000.0;
+		Params->TryGetNumberField(TEXT("fov"), Fov);
+		Params->TryGetNumberField(TEXT("aspect"), Aspect);
+		Params->TryGetNumberField(TEXT("near"), NearDistance);
+		Params->TryGetNumberField(TEXT("far"), FarDistance);
+		ActorIndex.QueryFrustum(World, MakeViewFrustum(Origin, Rotation, Fov, Aspect, NearDistance, FarDistance), Actors);
+	}
+	else if (Shape == TEXT("nearest"))
 	{
-		AActor* Actor = *It;
-		bool bMatch = true;
+		FVector Center;
+		if (!TryGetVectorField(Params, TEXT("center"), Center))
+		{
+			return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("nearest requires 'center'"));
+		}
 
-		if (!Pattern.IsEmpty() && !Actor->GetActorLabel().Contains(Pattern))
+		int32 Count = 10;
+		double MaxDistance = TNumericLimits<double>::Max();
+		Params->TryGetNumberField(TEXT("count"), Count);
+		Params->TryGetNumberField(TEXT("max_distance"), MaxDistance);
+
+		// The class filter applies during the search so other classes don't use up the count
+		FString ClassName;
+		TFunction<bool(AActor*)> Filter;
+		if (Params->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
 		{
-			bMatch = false;
+			Filter = [ClassName](AActor* Actor) { return Actor->GetClass()->GetName() == ClassName; };
 		}
+		ActorIndex.QueryNearest(World, Center, Count, MaxDistance, Matches, Filter);
+	}
+	else
+	{
+		return FGRIDBridge::CreateErrorResponse(TEXT("INVALID_PARAMETER"), FString::Printf(TEXT("Unknown shape '%s'; expected sphere, box, frustum or nearest"), *Shape));
+	}
+
+	for (AActor* Actor : Actors)
+	{
+		Matches.Emplace(Actor, -1.0);
+	}
+
+	FString ClassName;
+	Params->TryGetStringField(TEXT("class"), ClassName);
+
+	TArray<TSharedPtr<FJsonValue>> ActorArray;
+	for (const TPair<AActor*, double>& Match : Matches)
+	{
+		AActor* Actor = Match.Key;
 		if (!ClassName.IsEmpty() && Actor->GetClass()->GetName() != ClassName)
 		{
-			bMatch = false;
+			continue;
 		}
 
-		if (bMatch)
+		TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+		ActorObj->SetStringField(TEXT("name"), Actor->GetActorLabel());
+		ActorObj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+
+		FVector Location = Actor->GetActorLocation();
+		ActorObj->SetNumberField(TEXT("x"), Location.X);
+		ActorObj->SetNumberField(TEXT("y"), Location.Y);
+		ActorObj->SetNumberField(TEXT("z"), Location.Z);
+		if (Match.Value >= 0.0)
 		{
-			TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
-			ActorObj->SetStringField(TEXT("name"), Actor->GetActorLabel());
-			ActorObj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-			ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
+			ActorObj->SetNumberField(TEXT("distance"), Match.Value);
 		}
+
+		ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
 	}
 
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetArrayField(TEXT("actors"), ActorArray);
 	Data->SetNumberField(TEXT("count"), ActorArray.Num());
 
-	return CreateSuccess(Data);
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
 TSharedPtr<FJsonObject> FActorCommands::SpawnActor(const TSharedPtr<FJsonObject>& Params)
@@ -160,14 +414,14 @@ TSharedPtr<FJsonObject> FActorCommands::SpawnActor(const TSharedPtr<FJsonObject>
 	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 	if (!World)
 	{
-		return CreateError(TEXT("NO_WORLD"), TEXT("No active world"));
+		return FGRIDBridge::CreateErrorResponse(TEXT("NO_WORLD"), TEXT("No active world"));
 	}
 
 	UClass* ActorClass = nullptr;
 
 	if (!BlueprintPath.IsEmpty())
 	{
-		UBlueprint* Blueprint = Cast<UBlueprint>(StaticLoadObject(UBlueprint::StaticClass(), nullptr, *BlueprintPath));
+		UBlueprint* Blueprint = FGRIDObjectCache::Get().Load<UBlueprint>(BlueprintPath);
 		if (Blueprint && Blueprint->GeneratedClass)
 		{
 			ActorClass = Blueprint->GeneratedClass;
@@ -190,7 +444,7 @@ TSharedPtr<FJsonObject> FActorCommands::SpawnActor(const TSharedPtr<FJsonObject>
 
 	if (!NewActor)
 	{
-		return CreateError(TEXT("SPAWN_FAILED"), TEXT("Failed to spawn actor"));
+		return FGRIDBridge::CreateErrorResponse(TEXT("SPAWN_FAILED"), TEXT("Failed to spawn actor"));
 	}
 
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
@@ -200,86 +454,66 @@ TSharedPtr<FJsonObject> FActorCommands::SpawnActor(const TSharedPtr<FJsonObject>
 	Data->SetNumberField(TEXT("y"), Y);
 	Data->SetNumberField(TEXT("z"), Z);
 
-	return CreateSuccess(Data);
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
 // Stub implementations
 TSharedPtr<FJsonObject> FActorCommands::DeleteActor(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("DeleteActor not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("DeleteActor not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::GetActorInfo(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("GetActorInfo not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("GetActorInfo not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::GetTransform(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("GetTransform not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("GetTransform not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::SetTransform(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SetTransform not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SetTransform not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::SetLocation(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SetLocation not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SetLocation not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::SetRotation(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SetRotation not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SetRotation not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::SetScale(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SetScale not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SetScale not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::GetProperty(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("GetProperty not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("GetProperty not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::SetProperty(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SetProperty not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SetProperty not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::FocusActor(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("FocusActor not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("FocusActor not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::SelectActor(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SelectActor not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SelectActor not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FActorCommands::RenameActor(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("RenameActor not yet implemented"));
-}
-
-TSharedPtr<FJsonObject> FActorCommands::CreateError(const FString& Code, const FString& Message)
-{
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), false);
-	Result->SetStringField(TEXT("error_code"), Code);
-	Result->SetStringField(TEXT("error"), Message);
-	return Result;
-}
-
-TSharedPtr<FJsonObject> FActorCommands::CreateSuccess(const TSharedPtr<FJsonObject>& Data)
-{
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), true);
-	if (Data.IsValid())
-	{
-		Result->SetObjectField(TEXT("data"), Data);
-	}
-	return Result;
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("RenameActor not yet implemented"));
 }
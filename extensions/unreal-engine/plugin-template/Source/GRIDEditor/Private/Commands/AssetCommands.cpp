@@ -1,89 +1,172 @@
 // Copyright 2025 GRID. All Rights Reserved.
 
 #include "Commands/AssetCommands.h"
+#include "GRIDBridge.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Core/ToolRegistry.h"
+
+FAssetCommands::FAssetCommands()
+{
+	AssetIndex.Start();
+}
 
-FAssetCommands::FAssetCommands() {}
 FAssetCommands::~FAssetCommands() {}
 
-TSharedPtr<FJsonObject> FAssetCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FAssetCommands::RegisterCommands(FGRIDToolRegistry& Registry)
 {
-	if (CommandType == TEXT("asset_search")) return Search(Params);
-	if (CommandType == TEXT("asset_import_texture")) return ImportTexture(Params);
-	if (CommandType == TEXT("asset_export_texture")) return ExportTexture(Params);
-	if (CommandType == TEXT("asset_delete")) return Delete(Params);
-	if (CommandType == TEXT("asset_duplicate")) return Duplicate(Params);
-	if (CommandType == TEXT("asset_save")) return Save(Params);
-	if (CommandType == TEXT("asset_save_all")) return SaveAll(Params);
-	if (CommandType == TEXT("asset_list_references")) return ListReferences(Params);
-	if (CommandType == TEXT("asset_open")) return Open(Params);
-	return CreateError(TEXT("UNKNOWN_COMMAND"), FString::Printf(TEXT("Unknown asset command: %s"), *CommandType));
+	Registry.RegisterCommand(this, TEXT("asset_search"), &FAssetCommands::Search, TEXT("Asset"), TEXT("Search project assets by name and class, a page at a time"),
+		EGRIDThreadAffinity::AnyThread,
+		GRID_TOOL_PARAMS(
+			GRID_TOOL_PARAM("query", "Text the asset name must contain, ignoring case", "string", false),
+			GRID_TOOL_PARAM("type", "Asset class path to filter by", "string", false),
+			GRID_TOOL_PARAM("path", "Folder to search, including subfolders; /Game by default", "string", false),
+			GRID_TOOL_PARAM("fuzzy", "Match query characters in order anywhere in the name and return the best matches first", "bool", false),
+			GRID_TOOL_PARAM("max_results", "Matches kept by a fuzzy search; 100 by default, at most 1000", "int", false),
+			GRID_TOOL_PARAM("prefer_type", "Asset class path that ranks higher in a fuzzy search", "string", false),
+			GRID_TOOL_PARAM("near", "Folder whose neighbours rank higher in a fuzzy search", "string", false),
+			GRID_TOOL_PARAM("limit", "Assets per page", "int", false),
+			GRID_TOOL_PARAM("cursor", "next_cursor from the previous page", "string", false),
+			GRID_TOOL_PARAM("stream", "Send every page as it is produced", "bool", false)));
+	Registry.RegisterCommand(this, TEXT("asset_import_texture"), &FAssetCommands::ImportTexture, TEXT("Asset"), TEXT("Import a texture file as an asset"), EGRIDCommandPriority::Bulk);
+	Registry.RegisterCommand(this, TEXT("asset_export_texture"), &FAssetCommands::ExportTexture, TEXT("Asset"), TEXT("Export a texture asset to a file"), EGRIDCommandPriority::Bulk);
+	Registry.RegisterCommand(this, TEXT("asset_delete"), &FAssetCommands::Delete, TEXT("Asset"), TEXT("Delete an asset"));
+	Registry.RegisterCommand(this, TEXT("asset_duplicate"), &FAssetCommands::Duplicate, TEXT("Asset"), TEXT("Duplicate an asset"));
+	Registry.RegisterCommand(this, TEXT("asset_save"), &FAssetCommands::Save, TEXT("Asset"), TEXT("Save an asset"), EGRIDCommandPriority::Bulk);
+	Registry.RegisterCommand(this, TEXT("asset_save_all"), &FAssetCommands::SaveAll, TEXT("Asset"), TEXT("Save all modified assets"), EGRIDCommandPriority::Bulk);
+	Registry.RegisterCommand(this, TEXT("asset_list_references"), &FAssetCommands::ListReferences, TEXT("Asset"), TEXT("List the assets that reference an asset"),
+		EGRIDThreadAffinity::AnyThread,
+		GRID_TOOL_PARAMS(GRID_TOOL_PARAM("path", "Object path of the asset", "string", true)));
+	Registry.RegisterCommand(this, TEXT("asset_open"), &FAssetCommands::Open, TEXT("Asset"), TEXT("Open an asset in its editor"));
 }
 
 TSharedPtr<FJsonObject> FAssetCommands::Search(const TSharedPtr<FJsonObject>& Params)
 {
-	FString Query = Params->GetStringField(TEXT("query"));
-	FString Type = Params->GetStringField(TEXT("type"));
-
-	FAssetRegistryModule& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	TArray<FAssetData> Assets;
-
-	FARFilter Filter;
-	if (!Type.IsEmpty())
+	// A cursor resumes the matches found for the first page; otherwise search the registry
+	TSharedPtr<const TArray<FAssetData>> Snapshot;
+	FGuid SnapshotId;
+	int32 Start = 0;
+	FString Cursor;
+	if (Params->TryGetStringField(TEXT("cursor"), Cursor))
 	{
-		Filter.ClassPaths.Add(FTopLevelAssetPath(*Type));
+		Snapshot = SearchCursors.Resume(Cursor, SnapshotId, Start);
+		if (!Snapshot.IsValid())
+		{
+			return FGRIDBridge::CreateErrorResponse(TEXT("INVALID_CURSOR"), TEXT("Cursor is malformed or has expired; request the first page again"));
+		}
 	}
-	Filter.PackagePaths.Add(FName(TEXT("/Game")));
-	Filter.bRecursivePaths = true;
+	else
+	{
+		FString Query;
+		FString Type;
+		FString Path = TEXT("/Game");
+		Params->TryGetStringField(TEXT("query"), Query);
+		Params->TryGetStringField(TEXT("type"), Type);
+		Params->TryGetStringField(TEXT("path"), Path);
+		Path.RemoveFromEnd(TEXT("/"));
+		const FTopLevelAssetPath ClassPath = Type.IsEmpty() ? FTopLevelAssetPath() : FTopLevelAssetPath(*Type);
 
-	AssetRegistry.Get().GetAssets(Filter, Assets);
+		bool bFuzzy = false;
+		Params->TryGetBoolField(TEXT("fuzzy"), bFuzzy);
 
-	TArray<TSharedPtr<FJsonValue>> ResultArray;
-	for (const FAssetData& Asset : Assets)
-	{
-		if (!Query.IsEmpty() && !Asset.AssetName.ToString().Contains(Query))
+		// The ranker reserves room for every kept match up front, so cap what a request can ask for
+		constexpr int32 MaxRankedResults = 1000;
+		int32 MaxResults = 100;
+		Params->TryGetNumberField(TEXT("max_results"), MaxResults);
+		if (MaxResults <= 0)
+		{
+			return FGRIDBridge::CreateErrorResponse(TEXT("INVALID_PARAMETER"), TEXT("max_results must be a positive number"));
+		}
+		MaxResults = FMath::Min(MaxResults, MaxRankedResults);
+
+		// The index only holds /Game; plugin and engine folders always go to the registry
+		const bool bUseIndex = AssetIndex.IsReady() && FGRIDAssetIndex::CoversFolder(Path);
+
+		TArray<FAssetData> Assets;
+		bool bRanked = false;
+		if (bUseIndex && bFuzzy)
+		{
+			FString PreferType;
+			FGRIDAssetRankOptions Options;
+			if (Params->TryGetStringField(TEXT("prefer_type"), PreferType) && !PreferType.IsEmpty())
+			{
+				Options.PreferredClass = FTopLevelAssetPath(*PreferType);
+			}
+			Params->TryGetStringField(TEXT("near"), Options.NearFolder);
+
+			AssetIndex.FindRanked(Query, ClassPath, Path, Options, MaxResults, Assets);
+			bRanked = true;
+		}
+		else if (bUseIndex)
+		{
+			AssetIndex.Find(Query, ClassPath, Path, Assets);
+		}
+		else
 		{
-			continue;
+			// Until the registry's first scan completes, or outside /Game, ask it directly. Runs on a
+			// worker: the registry is thread-safe, the module manager is not.
+			IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+			FARFilter Filter;
+			if (ClassPath.IsValid())
+			{
+				Filter.ClassPaths.Add(ClassPath);
+			}
+			Filter.PackagePaths.Add(FName(*Path));
+			Filter.bRecursivePaths = true;
+			// In-memory assets can only be enumerated on the game thread, and the index never holds them
+			Filter.bIncludeOnlyOnDiskAssets = true;
+
+			AssetRegistry.GetAssets(Filter, Assets);
+
+			if (!Query.IsEmpty())
+			{
+				Assets.RemoveAllSwap([&Query](const FAssetData& Asset) { return !Asset.AssetName.ToString().Contains(Query); });
+			}
 		}
+		if (!bRanked)
+		{
+			Assets.Sort([](const FAssetData& A, const FAssetData& B)
+			{
+				return A.PackageName == B.PackageName ? A.AssetName.LexicalLess(B.AssetName) : A.PackageName.LexicalLess(B.PackageName);
+			});
+		}
+		Snapshot = MakeShared<const TArray<FAssetData>>(MoveTemp(Assets));
+	}
 
+	int32 Limit = 100;
+	Params->TryGetNumberField(TEXT("limit"), Limit);
+	const int32 End = Start + FMath::Min(FMath::Max(Limit, 1), Snapshot->Num() - Start);
+
+	TArray<TSharedPtr<FJsonValue>> ResultArray;
+	for (int32 Index = Start; Index < End; Index++)
+	{
+		const FAssetData& Asset = (*Snapshot)[Index];
 		TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
 		AssetObj->SetStringField(TEXT("name"), Asset.AssetName.ToString());
 		AssetObj->SetStringField(TEXT("path"), Asset.GetObjectPathString());
 		AssetObj->SetStringField(TEXT("class"), Asset.AssetClassPath.GetAssetName().ToString());
 		ResultArray.Add(MakeShared<FJsonValueObject>(AssetObj));
-
-		if (ResultArray.Num() >= 100) break;
 	}
 
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetArrayField(TEXT("assets"), ResultArray);
 	Data->SetNumberField(TEXT("count"), ResultArray.Num());
-	return CreateSuccess(Data);
-}
+	Data->SetNumberField(TEXT("total"), Snapshot->Num());
 
-TSharedPtr<FJsonObject> FAssetCommands::ImportTexture(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FAssetCommands::ExportTexture(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FAssetCommands::Delete(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FAssetCommands::Duplicate(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FAssetCommands::Save(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FAssetCommands::SaveAll(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FAssetCommands::ListReferences(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FAssetCommands::Open(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-
-TSharedPtr<FJsonObject> FAssetCommands::CreateError(const FString& Code, const FString& Message)
-{
-	TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-	R->SetBoolField(TEXT("success"), false);
-	R->SetStringField(TEXT("error_code"), Code);
-	R->SetStringField(TEXT("error"), Message);
-	return R;
+	const FString NextCursor = SearchCursors.Continue(SnapshotId, Snapshot.ToSharedRef(), End);
+	if (!NextCursor.IsEmpty())
+	{
+		Data->SetStringField(TEXT("next_cursor"), NextCursor);
+	}
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
-TSharedPtr<FJsonObject> FAssetCommands::CreateSuccess(const TSharedPtr<FJsonObject>& Data)
-{
-	TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-	R->SetBoolField(TEXT("success"), true);
-	if (Data.IsValid()) R->SetObjectField(TEXT("data"), Data);
-	return R;
-}
+TSharedPtr<FJsonObject> FAssetCommands::ImportTexture(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FAssetCommands::ExportTexture(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FAssetCommands::Delete(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FAssetCommands::Duplicate(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FAssetCommands::Save(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FAssetCommands::SaveAll(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FAssetCommands::ListReferences(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FAssetCommands::Open(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
@@ -1,6 +1,9 @@
 // Copyright 2025 GRID. All Rights Reserved.
 
 #include "Commands/BlueprintCommands.h"
+#include "GRIDBridge.h"
+#include "Core/ToolRegistry.h"
+#include "Core/ObjectCache.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -22,95 +25,33 @@ FBlueprintCommands::~FBlueprintCommands()
 {
 }
 
-TSharedPtr<FJsonObject> FBlueprintCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FBlueprintCommands::RegisterCommands(FGRIDToolRegistry& Registry)
 {
-	if (CommandType == TEXT("blueprint_create"))
-	{
-		return CreateBlueprint(Params);
-	}
-	else if (CommandType == TEXT("blueprint_compile"))
-	{
-		return CompileBlueprint(Params);
-	}
-	else if (CommandType == TEXT("blueprint_get_info"))
-	{
-		return GetBlueprintInfo(Params);
-	}
-	else if (CommandType == TEXT("blueprint_reparent"))
-	{
-		return ReparentBlueprint(Params);
-	}
-	else if (CommandType == TEXT("blueprint_get_property"))
-	{
-		return GetProperty(Params);
-	}
-	else if (CommandType == TEXT("blueprint_set_property"))
-	{
-		return SetProperty(Params);
-	}
-	else if (CommandType == TEXT("blueprint_add_component"))
-	{
-		return AddComponent(Params);
-	}
-	else if (CommandType == TEXT("blueprint_remove_component"))
-	{
-		return RemoveComponent(Params);
-	}
-	else if (CommandType == TEXT("blueprint_get_hierarchy"))
-	{
-		return GetComponentHierarchy(Params);
-	}
-	else if (CommandType == TEXT("blueprint_add_variable"))
-	{
-		return AddVariable(Params);
-	}
-	else if (CommandType == TEXT("blueprint_remove_variable"))
-	{
-		return RemoveVariable(Params);
-	}
-	else if (CommandType == TEXT("blueprint_list_variables"))
-	{
-		return ListVariables(Params);
-	}
-	else if (CommandType == TEXT("blueprint_add_function"))
-	{
-		return AddFunction(Params);
-	}
-	else if (CommandType == TEXT("blueprint_remove_function"))
-	{
-		return RemoveFunction(Params);
-	}
-	else if (CommandType == TEXT("blueprint_list_functions"))
-	{
-		return ListFunctions(Params);
-	}
-	else if (CommandType == TEXT("blueprint_discover_nodes"))
-	{
-		return DiscoverNodes(Params);
-	}
-	else if (CommandType == TEXT("blueprint_create_node"))
-	{
-		return CreateNode(Params);
-	}
-	else if (CommandType == TEXT("blueprint_delete_node"))
-	{
-		return DeleteNode(Params);
-	}
-	else if (CommandType == TEXT("blueprint_connect_nodes"))
-	{
-		return ConnectNodes(Params);
-	}
-	else if (CommandType == TEXT("blueprint_list_nodes"))
-	{
-		return ListNodes(Params);
-	}
-
-	return CreateError(TEXT("UNKNOWN_COMMAND"), FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
+	Registry.RegisterCommand(this, TEXT("blueprint_create"), &FBlueprintCommands::CreateBlueprint, TEXT("Blueprint"), TEXT("Create a Blueprint from a parent class"));
+	Registry.RegisterCommand(this, TEXT("blueprint_compile"), &FBlueprintCommands::CompileBlueprint, TEXT("Blueprint"), TEXT("Compile a Blueprint"), EGRIDCommandPriority::Bulk);
+	Registry.RegisterCommand(this, TEXT("blueprint_get_info"), &FBlueprintCommands::GetBlueprintInfo, TEXT("Blueprint"), TEXT("Get a Blueprint's parent class, variables and functions"));
+	Registry.RegisterCommand(this, TEXT("blueprint_reparent"), &FBlueprintCommands::ReparentBlueprint, TEXT("Blueprint"), TEXT("Change a Blueprint's parent class"));
+	Registry.RegisterCommand(this, TEXT("blueprint_get_property"), &FBlueprintCommands::GetProperty, TEXT("Blueprint"), TEXT("Get a default property value of a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_set_property"), &FBlueprintCommands::SetProperty, TEXT("Blueprint"), TEXT("Set a default property value of a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_add_component"), &FBlueprintCommands::AddComponent, TEXT("Blueprint"), TEXT("Add a component to a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_remove_component"), &FBlueprintCommands::RemoveComponent, TEXT("Blueprint"), TEXT("Remove a component from a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_get_hierarchy"), &FBlueprintCommands::GetComponentHierarchy, TEXT("Blueprint"), TEXT("Get a Blueprint's component hierarchy"));
+	Registry.RegisterCommand(this, TEXT("blueprint_add_variable"), &FBlueprintCommands::AddVariable, TEXT("Blueprint"), TEXT("Add a variable to a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_remove_variable"), &FBlueprintCommands::RemoveVariable, TEXT("Blueprint"), TEXT("Remove a variable from a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_list_variables"), &FBlueprintCommands::ListVariables, TEXT("Blueprint"), TEXT("List a Blueprint's variables"));
+	Registry.RegisterCommand(this, TEXT("blueprint_add_function"), &FBlueprintCommands::AddFunction, TEXT("Blueprint"), TEXT("Add a function graph to a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_remove_function"), &FBlueprintCommands::RemoveFunction, TEXT("Blueprint"), TEXT("Remove a function graph from a Blueprint"));
+	Registry.RegisterCommand(this, TEXT("blueprint_list_functions"), &FBlueprintCommands::ListFunctions, TEXT("Blueprint"), TEXT("List a Blueprint's functions"));
+	Registry.RegisterCommand(this, TEXT("blueprint_discover_nodes"), &FBlueprintCommands::DiscoverNodes, TEXT("Blueprint"), TEXT("List node types that can be placed in a graph"));
+	Registry.RegisterCommand(this, TEXT("blueprint_create_node"), &FBlueprintCommands::CreateNode, TEXT("Blueprint"), TEXT("Create a node in a Blueprint graph"));
+	Registry.RegisterCommand(this, TEXT("blueprint_delete_node"), &FBlueprintCommands::DeleteNode, TEXT("Blueprint"), TEXT("Delete a node from a Blueprint graph"));
+	Registry.RegisterCommand(this, TEXT("blueprint_connect_nodes"), &FBlueprintCommands::ConnectNodes, TEXT("Blueprint"), TEXT("Connect two pins in a Blueprint graph"));
+	Registry.RegisterCommand(this, TEXT("blueprint_list_nodes"), &FBlueprintCommands::ListNodes, TEXT("Blueprint"), TEXT("List the nodes in a Blueprint graph"));
 }
 
 UBlueprint* FBlueprintCommands::LoadBlueprint(const FString& Path)
 {
-	return Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(Path));
+	return FGRIDObjectCache::Get().Load<UBlueprint>(Path);
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::CreateBlueprint(const TSharedPtr<FJsonObject>& Params)
@@ -120,7 +61,7 @@ TSharedPtr<FJsonObject> FBlueprintCommands::CreateBlueprint(const TSharedPtr<FJs
 
 	if (Path.IsEmpty())
 	{
-		return CreateError(TEXT("MISSING_PATH"), TEXT("Blueprint path is required"));
+		return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PATH"), TEXT("Blueprint path is required"));
 	}
 
 	// Default to Actor
@@ -153,7 +94,7 @@ TSharedPtr<FJsonObject> FBlueprintCommands::CreateBlueprint(const TSharedPtr<FJs
 
 	if (!Blueprint)
 	{
-		return CreateError(TEXT("CREATE_FAILED"), TEXT("Failed to create blueprint"));
+		return FGRIDBridge::CreateErrorResponse(TEXT("CREATE_FAILED"), TEXT("Failed to create blueprint"));
 	}
 
 	// Save
@@ -166,7 +107,7 @@ TSharedPtr<FJsonObject> FBlueprintCommands::CreateBlueprint(const TSharedPtr<FJs
 	Data->SetStringField(TEXT("name"), AssetName);
 	Data->SetStringField(TEXT("parent_class"), Parent->GetName());
 
-	return CreateSuccess(Data);
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::CompileBlueprint(const TSharedPtr<FJsonObject>& Params)
@@ -176,7 +117,7 @@ TSharedPtr<FJsonObject> FBlueprintCommands::CompileBlueprint(const TSharedPtr<FJ
 
 	if (!Blueprint)
 	{
-		return CreateError(TEXT("NOT_FOUND"), FString::Printf(TEXT("Blueprint not found: %s"), *Path));
+		return FGRIDBridge::CreateErrorResponse(TEXT("NOT_FOUND"), FString::Printf(TEXT("Blueprint not found: %s"), *Path));
 	}
 
 	FKismetEditorUtilities::CompileBlueprint(Blueprint);
@@ -186,7 +127,7 @@ TSharedPtr<FJsonObject> FBlueprintCommands::CompileBlueprint(const TSharedPtr<FJ
 	Data->SetBoolField(TEXT("compiled"), true);
 	Data->SetBoolField(TEXT("has_errors"), Blueprint->Status == BS_Error);
 
-	return CreateSuccess(Data);
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::GetBlueprintInfo(const TSharedPtr<FJsonObject>& Params)
@@ -196,7 +137,7 @@ TSharedPtr<FJsonObject> FBlueprintCommands::GetBlueprintInfo(const TSharedPtr<FJ
 
 	if (!Blueprint)
 	{
-		return CreateError(TEXT("NOT_FOUND"), FString::Printf(TEXT("Blueprint not found: %s"), *Path));
+		return FGRIDBridge::CreateErrorResponse(TEXT("NOT_FOUND"), FString::Printf(TEXT("Blueprint not found: %s"), *Path));
 	}
 
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
@@ -222,116 +163,96 @@ TSharedPtr<FJsonObject> FBlueprintCommands::GetBlueprintInfo(const TSharedPtr<FJ
 	}
 	Data->SetNumberField(TEXT("function_count"), FunctionCount);
 
-	return CreateSuccess(Data);
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
 // Stub implementations for remaining methods
 TSharedPtr<FJsonObject> FBlueprintCommands::ReparentBlueprint(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("ReparentBlueprint not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("ReparentBlueprint not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::GetProperty(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("GetProperty not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("GetProperty not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::SetProperty(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SetProperty not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SetProperty not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::AddComponent(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("AddComponent not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("AddComponent not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::RemoveComponent(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("RemoveComponent not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("RemoveComponent not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::GetComponentHierarchy(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("GetComponentHierarchy not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("GetComponentHierarchy not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::SetComponentProperty(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("SetComponentProperty not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("SetComponentProperty not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::AddVariable(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("AddVariable not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("AddVariable not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::RemoveVariable(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("RemoveVariable not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("RemoveVariable not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::ListVariables(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("ListVariables not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("ListVariables not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::AddFunction(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("AddFunction not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("AddFunction not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::RemoveFunction(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("RemoveFunction not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("RemoveFunction not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::ListFunctions(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("ListFunctions not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("ListFunctions not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::DiscoverNodes(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("DiscoverNodes not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("DiscoverNodes not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::CreateNode(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("CreateNode not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("CreateNode not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::DeleteNode(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("DeleteNode not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("DeleteNode not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::ConnectNodes(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("ConnectNodes not yet implemented"));
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("ConnectNodes not yet implemented"));
 }
 
 TSharedPtr<FJsonObject> FBlueprintCommands::ListNodes(const TSharedPtr<FJsonObject>& Params)
 {
-	return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("ListNodes not yet implemented"));
-}
-
-TSharedPtr<FJsonObject> FBlueprintCommands::CreateError(const FString& Code, const FString& Message)
-{
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), false);
-	Result->SetStringField(TEXT("error_code"), Code);
-	Result->SetStringField(TEXT("error"), Message);
-	return Result;
-}
-
-TSharedPtr<FJsonObject> FBlueprintCommands::CreateSuccess(const TSharedPtr<FJsonObject>& Data)
-{
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), true);
-	if (Data.IsValid())
-	{
-		Result->SetObjectField(TEXT("data"), Data);
-	}
-	return Result;
+	return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("ListNodes not yet implemented"));
 }
@@ -1,6 +1,8 @@
 // Copyright 2025 GRID. All Rights Reserved.
 
 #include "Commands/InputCommands.h"
+#include "GRIDBridge.h"
+#include "Core/ToolRegistry.h"
 #include "InputAction.h"
 #include "InputMappingContext.h"
 #include "EditorAssetLibrary.h"
@@ -8,53 +10,35 @@
 FInputCommands::FInputCommands() {}
 FInputCommands::~FInputCommands() {}
 
-TSharedPtr<FJsonObject> FInputCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FInputCommands::RegisterCommands(FGRIDToolRegistry& Registry)
 {
-	if (CommandType == TEXT("input_create_action")) return CreateAction(Params);
-	if (CommandType == TEXT("input_list_actions")) return ListActions(Params);
-	if (CommandType == TEXT("input_create_context")) return CreateMappingContext(Params);
-	if (CommandType == TEXT("input_list_contexts")) return ListMappingContexts(Params);
-	if (CommandType == TEXT("input_add_mapping")) return AddKeyMapping(Params);
-	if (CommandType == TEXT("input_remove_mapping")) return RemoveKeyMapping(Params);
-	if (CommandType == TEXT("input_get_mappings")) return GetMappings(Params);
-	if (CommandType == TEXT("input_get_keys")) return GetAvailableKeys(Params);
-	if (CommandType == TEXT("input_add_modifier")) return AddModifier(Params);
-	if (CommandType == TEXT("input_remove_modifier")) return RemoveModifier(Params);
-	if (CommandType == TEXT("input_add_trigger")) return AddTrigger(Params);
-	if (CommandType == TEXT("input_remove_trigger")) return RemoveTrigger(Params);
-	return CreateError(TEXT("UNKNOWN_COMMAND"), FString::Printf(TEXT("Unknown input command: %s"), *CommandType));
+	Registry.RegisterCommand(this, TEXT("input_create_action"), &FInputCommands::CreateAction, TEXT("Input"), TEXT("Create an Input Action asset"));
+	Registry.RegisterCommand(this, TEXT("input_list_actions"), &FInputCommands::ListActions, TEXT("Input"), TEXT("List Input Action assets"));
+	Registry.RegisterCommand(this, TEXT("input_create_context"), &FInputCommands::CreateMappingContext, TEXT("Input"), TEXT("Create an Input Mapping Context asset"));
+	Registry.RegisterCommand(this, TEXT("input_list_contexts"), &FInputCommands::ListMappingContexts, TEXT("Input"), TEXT("List Input Mapping Context assets"));
+	Registry.RegisterCommand(this, TEXT("input_add_mapping"), &FInputCommands::AddKeyMapping, TEXT("Input"), TEXT("Map a key to an action in a mapping context"));
+	Registry.RegisterCommand(this, TEXT("input_remove_mapping"), &FInputCommands::RemoveKeyMapping, TEXT("Input"), TEXT("Remove a key mapping from a mapping context"));
+	Registry.RegisterCommand(this, TEXT("input_get_mappings"), &FInputCommands::GetMappings, TEXT("Input"), TEXT("List the key mappings in a mapping context"));
+	Registry.RegisterCommand(this, TEXT("input_get_keys"), &FInputCommands::GetAvailableKeys, TEXT("Input"), TEXT("List the keys available for mappings"));
+	Registry.RegisterCommand(this, TEXT("input_add_modifier"), &FInputCommands::AddModifier, TEXT("Input"), TEXT("Add a modifier to a key mapping"));
+	Registry.RegisterCommand(this, TEXT("input_remove_modifier"), &FInputCommands::RemoveModifier, TEXT("Input"), TEXT("Remove a modifier from a key mapping"));
+	Registry.RegisterCommand(this, TEXT("input_add_trigger"), &FInputCommands::AddTrigger, TEXT("Input"), TEXT("Add a trigger to a key mapping"));
+	Registry.RegisterCommand(this, TEXT("input_remove_trigger"), &FInputCommands::RemoveTrigger, TEXT("Input"), TEXT("Remove a trigger from a key mapping"));
 }
 
-TSharedPtr<FJsonObject> FInputCommands::CreateAction(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::ListActions(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::GetActionProperties(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::ConfigureAction(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::CreateMappingContext(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::ListMappingContexts(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::GetMappings(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::AddKeyMapping(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::RemoveKeyMapping(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::GetAvailableKeys(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::AddModifier(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::RemoveModifier(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::ListModifiers(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::AddTrigger(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::RemoveTrigger(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FInputCommands::ListTriggers(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-
-TSharedPtr<FJsonObject> FInputCommands::CreateError(const FString& Code, const FString& Message)
-{
-	TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-	R->SetBoolField(TEXT("success"), false);
-	R->SetStringField(TEXT("error_code"), Code);
-	R->SetStringField(TEXT("error"), Message);
-	return R;
-}
-
-TSharedPtr<FJsonObject> FInputCommands::CreateSuccess(const TSharedPtr<FJsonObject>& Data)
-{
-	TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-	R->SetBoolField(TEXT("success"), true);
-	if (Data.IsValid()) R->SetObjectField(TEXT("data"), Data);
-	return R;
-}
+TSharedPtr<FJsonObject> FInputCommands::CreateAction(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::ListActions(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::GetActionProperties(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::ConfigureAction(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::CreateMappingContext(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::ListMappingContexts(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::GetMappings(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::AddKeyMapping(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::RemoveKeyMapping(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::GetAvailableKeys(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::AddModifier(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::RemoveModifier(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::ListModifiers(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::AddTrigger(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::RemoveTrigger(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FInputCommands::ListTriggers(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
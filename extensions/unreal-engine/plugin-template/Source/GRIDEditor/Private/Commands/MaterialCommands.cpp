@@ -1,6 +1,8 @@
 // Copyright 2025 GRID. All Rights Reserved.
 
 #include "Commands/MaterialCommands.h"
+#include "GRIDBridge.h"
+#include "Core/ToolRegistry.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstanceConstant.h"
 #include "Factories/MaterialFactoryNew.h"
@@ -11,20 +13,19 @@
 FMaterialCommands::FMaterialCommands() {}
 FMaterialCommands::~FMaterialCommands() {}
 
-TSharedPtr<FJsonObject> FMaterialCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FMaterialCommands::RegisterCommands(FGRIDToolRegistry& Registry)
 {
-	if (CommandType == TEXT("material_create")) return CreateMaterial(Params);
-	if (CommandType == TEXT("material_create_instance")) return CreateMaterialInstance(Params);
-	if (CommandType == TEXT("material_get_info")) return GetMaterialInfo(Params);
-	if (CommandType == TEXT("material_compile")) return Compile(Params);
-	if (CommandType == TEXT("material_save")) return Save(Params);
-	return CreateError(TEXT("UNKNOWN_COMMAND"), FString::Printf(TEXT("Unknown material command: %s"), *CommandType));
+	Registry.RegisterCommand(this, TEXT("material_create"), &FMaterialCommands::CreateMaterial, TEXT("Material"), TEXT("Create a material"));
+	Registry.RegisterCommand(this, TEXT("material_create_instance"), &FMaterialCommands::CreateMaterialInstance, TEXT("Material"), TEXT("Create a material instance"));
+	Registry.RegisterCommand(this, TEXT("material_get_info"), &FMaterialCommands::GetMaterialInfo, TEXT("Material"), TEXT("Get a material's parameters and usage"));
+	Registry.RegisterCommand(this, TEXT("material_compile"), &FMaterialCommands::Compile, TEXT("Material"), TEXT("Recompile a material"), EGRIDCommandPriority::Bulk);
+	Registry.RegisterCommand(this, TEXT("material_save"), &FMaterialCommands::Save, TEXT("Material"), TEXT("Save a material"), EGRIDCommandPriority::Bulk);
 }
 
 TSharedPtr<FJsonObject> FMaterialCommands::CreateMaterial(const TSharedPtr<FJsonObject>& Params)
 {
 	FString Path = Params->GetStringField(TEXT("path"));
-	if (Path.IsEmpty()) return CreateError(TEXT("MISSING_PATH"), TEXT("Material path required"));
+	if (Path.IsEmpty()) return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PATH"), TEXT("Material path required"));
 
 	UMaterialFactoryNew* Factory = NewObject<UMaterialFactoryNew>();
 	FString PackagePath = FPackageName::ObjectPathToPackageName(Path);
@@ -35,7 +36,7 @@ TSharedPtr<FJsonObject> FMaterialCommands::CreateMaterial(const TSharedPtr<FJson
 		UMaterial::StaticClass(), Package, *AssetName,
 		RF_Public | RF_Standalone, nullptr, GWarn));
 
-	if (!Material) return CreateError(TEXT("CREATE_FAILED"), TEXT("Failed to create material"));
+	if (!Material) return FGRIDBridge::CreateErrorResponse(TEXT("CREATE_FAILED"), TEXT("Failed to create material"));
 
 	FAssetRegistryModule::AssetCreated(Material);
 	Material->MarkPackageDirty();
@@ -44,36 +45,19 @@ TSharedPtr<FJsonObject> FMaterialCommands::CreateMaterial(const TSharedPtr<FJson
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetStringField(TEXT("path"), Path);
 	Data->SetStringField(TEXT("name"), AssetName);
-	return CreateSuccess(Data);
+	return FGRIDBridge::CreateSuccessResponse(Data);
 }
 
-TSharedPtr<FJsonObject> FMaterialCommands::CreateMaterialInstance(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::GetMaterialInfo(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::GetProperty(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::SetProperty(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::ListParameters(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::SetParameter(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::Compile(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::Save(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::DiscoverNodeTypes(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::CreateNode(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::DeleteNode(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::ConnectNodes(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-TSharedPtr<FJsonObject> FMaterialCommands::ListNodes(const TSharedPtr<FJsonObject>& Params) { return CreateError(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
-
-TSharedPtr<FJsonObject> FMaterialCommands::CreateError(const FString& Code, const FString& Message)
-{
-	TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-	R->SetBoolField(TEXT("success"), false);
-	R->SetStringField(TEXT("error_code"), Code);
-	R->SetStringField(TEXT("error"), Message);
-	return R;
-}
-
-TSharedPtr<FJsonObject> FMaterialCommands::CreateSuccess(const TSharedPtr<FJsonObject>& Data)
-{
-	TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-	R->SetBoolField(TEXT("success"), true);
-	if (Data.IsValid()) R->SetObjectField(TEXT("data"), Data);
-	return R;
-}
+TSharedPtr<FJsonObject> FMaterialCommands::CreateMaterialInstance(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::GetMaterialInfo(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::GetProperty(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::SetProperty(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::ListParameters(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::SetParameter(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::Compile(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::Save(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::DiscoverNodeTypes(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::CreateNode(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::DeleteNode(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::ConnectNodes(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
+TSharedPtr<FJsonObject> FMaterialCommands::ListNodes(const TSharedPtr<FJsonObject>& Params) { return FGRIDBridge::CreateErrorResponse(TEXT("NOT_IMPLEMENTED"), TEXT("Not implemented")); }
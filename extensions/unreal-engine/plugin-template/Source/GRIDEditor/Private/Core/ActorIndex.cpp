@@ -0,0 +1,400 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/ActorIndex.h"
+#include "Core/ThreadCheck.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Editor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+#include "ConvexVolume.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+	/** Half-size of the octree's root: about 21 km each way. Actors beyond it are kept in the root node. */
+	constexpr double OctreeExtent = 2097152.0;
+
+	/** First radius tried by nearest-neighbour queries; it grows fourfold until enough actors are inside */
+	constexpr double NearestStartRadius = 1000.0;
+}
+
+FGRIDActorIndex::FGRIDActorIndex()
+{
+}
+
+FGRIDActorIndex::~FGRIDActorIndex()
+{
+	Unsubscribe();
+}
+
+void FGRIDActorIndex::FindByLabel(UWorld* World, const FString& Label, TArray<AActor*>& OutActors)
+{
+	EnsureWorld(World);
+	Collect(ByLabel.Find(Label), OutActors);
+}
+
+AActor* FGRIDActorIndex::FindFirstByLabel(UWorld* World, const FString& Label)
+{
+	EnsureWorld(World);
+	if (const TSet<TWeakObjectPtr<AActor>>* Bucket = ByLabel.Find(Label))
+	{
+		for (const TWeakObjectPtr<AActor>& Actor : *Bucket)
+		{
+			if (IsValid(Actor.Get()))
+			{
+				return Actor.Get();
+			}
+		}
+	}
+	return nullptr;
+}
+
+void FGRIDActorIndex::FindByClass(UWorld* World, FName ClassName, TArray<AActor*>& OutActors)
+{
+	EnsureWorld(World);
+	Collect(ByClass.Find(ClassName), OutActors);
+}
+
+void FGRIDActorIndex::FindByTag(UWorld* World, FName Tag, TArray<AActor*>& OutActors)
+{
+	EnsureWorld(World);
+	Collect(ByTag.Find(Tag), OutActors);
+}
+
+void FGRIDActorIndex::QuerySphere(UWorld* World, const FVector& Center, double Radius, TArray<AActor*>& OutActors)
+{
+	EnsureWorld(World);
+	const double RadiusSquared = Radius * Radius;
+	VisitBox(FBoxCenterAndExtent(Center, FVector(Radius)), [&](AActor* Actor, const FBox& Box)
+	{
+		if (Box.ComputeSquaredDistanceToPoint(Center) <= RadiusSquared)
+		{
+			OutActors.Add(Actor);
+		}
+	});
+}
+
+void FGRIDActorIndex::QueryBox(UWorld* World, const FBox& Box, TArray<AActor*>& OutActors)
+{
+	EnsureWorld(World);
+	VisitBox(FBoxCenterAndExtent(Box), [&OutActors](AActor* Actor, const FBox& Bounds)
+	{
+		OutActors.Add(Actor);
+	});
+}
+
+void FGRIDActorIndex::QueryFrustum(UWorld* World, const FConvexVolume& Frustum, TArray<AActor*>& OutActors)
+{
+	EnsureWorld(World);
+	if (!Octree)
+	{
+		return;
+	}
+
+	// Whole nodes outside the volume are skipped along with everything below them
+	Octree->FindElementsWithPredicate(
+		[&Frustum](FOctreeNodeIndex ParentNodeIndex, FOctreeNodeIndex NodeIndex, const FBoxCenterAndExtent& NodeBounds)
+		{
+			return Frustum.IntersectBox(NodeBounds.Center, NodeBounds.Extent);
+		},
+		[&Frustum, &OutActors](FOctreeNodeIndex ParentNodeIndex, const FGRIDActorOctreeElement& Element)
+		{
+			AActor* Actor = Element.Actor.Get();
+			if (IsValid(Actor) && Frustum.IntersectBox(Element.Bounds.Center, Element.Bounds.Extent))
+			{
+				OutActors.Add(Actor);
+			}
+		});
+}
+
+void FGRIDActorIndex::QueryNearest(UWorld* World, const FVector& Point, int32 Count, double MaxDistance, TArray<TPair<AActor*, double>>& OutActors,
+	const TFunction<bool(AActor*)>& Filter)
+{
+	EnsureWorld(World);
+	if (Count <= 0 || MaxDistance < 0.0)
+	{
+		return;
+	}
+
+	// Everything within Radius of Point overlaps the box of that half-size, so once Count actors
+	// lie within Radius the nearest Count are among them
+	TArray<TPair<AActor*, double>> Found;
+	double Radius = FMath::Min(NearestStartRadius, MaxDistance);
+	for (;;)
+	{
+		Found.Reset();
+		const double RadiusSquared = Radius * Radius;
+		VisitBox(FBoxCenterAndExtent(Point, FVector(Radius)), [&](AActor* Actor, const FBox& Box)
+		{
+			const double DistanceSquared = Box.ComputeSquaredDistanceToPoint(Point);
+			if (DistanceSquared <= RadiusSquared && (!Filter || Filter(Actor)))
+			{
+				Found.Emplace(Actor, DistanceSquared);
+			}
+		});
+
+		if (Found.Num() >= Count || Radius >= MaxDistance || Radius >= OctreeExtent * 4.0)
+		{
+			break;
+		}
+		Radius = FMath::Min(Radius * 4.0, MaxDistance);
+	}
+
+	const int32 Keep = FMath::Min(Count, Found.Num());
+	auto Closer = [](const TPair<AActor*, double>& A, const TPair<AActor*, double>& B) { return A.Value < B.Value; };
+	Algo::Sort(Found, Closer);
+	OutActors.Reserve(OutActors.Num() + Keep);
+	for (int32 Index = 0; Index < Keep; Index++)
+	{
+		OutActors.Emplace(Found[Index].Key, FMath::Sqrt(Found[Index].Value));
+	}
+}
+
+void FGRIDActorIndex::ForEach(UWorld* World, TFunctionRef<bool(AActor*, const FString&)> Visitor)
+{
+	EnsureWorld(World);
+	for (const TPair<TWeakObjectPtr<AActor>, FEntry>& Pair : Entries)
+	{
+		AActor* Actor = Pair.Key.Get();
+		if (IsValid(Actor) && !Visitor(Actor, Pair.Value.Label))
+		{
+			return;
+		}
+	}
+}
+
+void FGRIDActorIndex::EnsureWorld(UWorld* World)
+{
+	GRIDCheckGameThread(TEXT("FGRIDActorIndex::EnsureWorld"));
+
+	Subscribe();
+	if (bDirty || IndexedWorld.Get() != World)
+	{
+		Rebuild(World);
+	}
+}
+
+void FGRIDActorIndex::Rebuild(UWorld* World)
+{
+	Entries.Reset();
+	ByLabel.Reset();
+	ByClass.Reset();
+	ByTag.Reset();
+	Octree = MakeUnique<FGRIDActorOctree>(FVector::ZeroVector, OctreeExtent);
+
+	IndexedWorld = World;
+	bDirty = false;
+	RebuildCount++;
+	if (!World)
+	{
+		return;
+	}
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AddActor(*It);
+	}
+}
+
+void FGRIDActorIndex::AddActor(AActor* Actor)
+{
+	FEntry Entry;
+	Entry.Label = Actor->GetActorLabel();
+	Entry.ClassName = Actor->GetClass()->GetFName();
+	Entry.Tags = Actor->Tags;
+
+	const TWeakObjectPtr<AActor> Key(Actor);
+	ByLabel.FindOrAdd(Entry.Label).Add(Key);
+	ByClass.FindOrAdd(Entry.ClassName).Add(Key);
+	for (const FName& Tag : Entry.Tags)
+	{
+		ByTag.FindOrAdd(Tag).Add(Key);
+	}
+
+	// Actors without primitives are indexed as a point at their root
+	if (Actor->GetRootComponent())
+	{
+		FBox Box = Actor->GetComponentsBoundingBox(true);
+		if (!Box.IsValid)
+		{
+			Box = FBox(Actor->GetActorLocation(), Actor->GetActorLocation());
+		}
+		Entry.OctreeId = MakeShared<FOctreeElementId2>();
+		Octree->AddElement({ Key, FBoxCenterAndExtent(Box), Entry.OctreeId });
+	}
+	Entries.Add(Key, MoveTemp(Entry));
+}
+
+void FGRIDActorIndex::RemoveActor(const TWeakObjectPtr<AActor>& Actor)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Actor, Entry))
+	{
+		return;
+	}
+
+	// Empty buckets are dropped so renamed-away labels don't accumulate
+	auto RemoveFrom = [&Actor](auto& Buckets, const auto& BucketKey)
+	{
+		if (TSet<TWeakObjectPtr<AActor>>* Bucket = Buckets.Find(BucketKey))
+		{
+			Bucket->Remove(Actor);
+			if (Bucket->Num() == 0)
+			{
+				Buckets.Remove(BucketKey);
+			}
+		}
+	};
+	RemoveFrom(ByLabel, Entry.Label);
+	RemoveFrom(ByClass, Entry.ClassName);
+	for (const FName& Tag : Entry.Tags)
+	{
+		RemoveFrom(ByTag, Tag);
+	}
+
+	if (Entry.OctreeId.IsValid() && Entry.OctreeId->IsValidId())
+	{
+		Octree->RemoveElement(*Entry.OctreeId);
+	}
+}
+
+void FGRIDActorIndex::ReindexActor(AActor* Actor)
+{
+	if (IsTracked(Actor) && Entries.Contains(Actor))
+	{
+		RemoveActor(Actor);
+		AddActor(Actor);
+	}
+}
+
+bool FGRIDActorIndex::IsTracked(const AActor* Actor) const
+{
+	return !bDirty && Actor && IndexedWorld.IsValid() && Actor->GetWorld() == IndexedWorld.Get();
+}
+
+void FGRIDActorIndex::VisitBox(const FBoxCenterAndExtent& Bounds, TFunctionRef<void(AActor*, const FBox&)> Visitor) const
+{
+	if (!Octree)
+	{
+		return;
+	}
+
+	Octree->FindElementsWithBoundsTest(Bounds, [&Visitor](const FGRIDActorOctreeElement& Element)
+	{
+		AActor* Actor = Element.Actor.Get();
+		if (IsValid(Actor))
+		{
+			Visitor(Actor, Element.Bounds.GetBox());
+		}
+	});
+}
+
+void FGRIDActorIndex::Collect(const TSet<TWeakObjectPtr<AActor>>* Bucket, TArray<AActor*>& OutActors)
+{
+	if (!Bucket)
+	{
+		return;
+	}
+
+	OutActors.Reserve(OutActors.Num() + Bucket->Num());
+	for (const TWeakObjectPtr<AActor>& Actor : *Bucket)
+	{
+		if (IsValid(Actor.Get()))
+		{
+			OutActors.Add(Actor.Get());
+		}
+	}
+}
+
+void FGRIDActorIndex::Subscribe()
+{
+	if (bSubscribed || !GEngine)
+	{
+		return;
+	}
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FGRIDActorIndex::OnActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FGRIDActorIndex::OnActorDeleted);
+	LabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FGRIDActorIndex::OnActorLabelChanged);
+	ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FGRIDActorIndex::OnActorMoved);
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FGRIDActorIndex::OnObjectPropertyChanged);
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FGRIDActorIndex::OnLevelsChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FGRIDActorIndex::OnLevelsChanged);
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FGRIDActorIndex::Invalidate);
+	bSubscribed = true;
+}
+
+void FGRIDActorIndex::Unsubscribe()
+{
+	if (!bSubscribed)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(LabelChangedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+	bSubscribed = false;
+}
+
+void FGRIDActorIndex::OnActorAdded(AActor* Actor)
+{
+	if (IsTracked(Actor))
+	{
+		RemoveActor(Actor);
+		AddActor(Actor);
+	}
+}
+
+void FGRIDActorIndex::OnActorDeleted(AActor* Actor)
+{
+	if (IsTracked(Actor))
+	{
+		RemoveActor(Actor);
+	}
+}
+
+void FGRIDActorIndex::OnActorLabelChanged(AActor* Actor)
+{
+	ReindexActor(Actor);
+}
+
+void FGRIDActorIndex::OnActorMoved(AActor* Actor)
+{
+	ReindexActor(Actor);
+}
+
+void FGRIDActorIndex::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	// Tags have no dedicated notification; the details panel reports them as a property edit
+	AActor* Actor = Cast<AActor>(Object);
+	if (Actor && Event.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags))
+	{
+		ReindexActor(Actor);
+	}
+}
+
+void FGRIDActorIndex::OnLevelsChanged(ULevel* Level, UWorld* World)
+{
+	if (World && World == IndexedWorld.Get())
+	{
+		Invalidate();
+	}
+}
+
+void FGRIDActorIndex::Invalidate()
+{
+	bDirty = true;
+}
@@ -0,0 +1,496 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/AssetIndex.h"
+#include "Core/ThreadCheck.h"
+#include "Core/FuzzyScorer.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/ScopeRWLock.h"
+#include "Editor.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+namespace
+{
+	const FName GameRoot(TEXT("/Game"));
+
+	constexpr int32 PreferredClassBonus = 20;
+	constexpr int32 FolderBonusPerLevel = 3;
+	constexpr int32 MaxFolderBonus = 15;
+	constexpr int32 RecentUseBonus = 25;
+
+	/** The recent-use bonus fades to nothing over this long */
+	constexpr double RecentUseSeconds = 3600.0;
+
+	/** Folders two lowercase, '/'-terminated paths share from the root */
+	int32 CountSharedFolders(const FString& A, const FString& B)
+	{
+		const int32 Length = FMath::Min(A.Len(), B.Len());
+		int32 Shared = 0;
+		for (int32 Index = 1; Index < Length && A[Index] == B[Index]; Index++)
+		{
+			Shared += A[Index] == TEXT('/') ? 1 : 0;
+		}
+		return Shared;
+	}
+
+	/** Only assets under /Game are searched, as before the index */
+	bool IsUnderGame(const FAssetData& Asset)
+	{
+		if (Asset.PackagePath == GameRoot)
+		{
+			return true;
+		}
+
+		TStringBuilder<256> Path;
+		Asset.PackagePath.ToString(Path);
+		return FStringView(Path).StartsWith(TEXT("/Game/"));
+	}
+
+	/** Posting key for a run of two or three characters; the length is kept so a bigram never collides with a trigram */
+	uint64 MakeKey(const TCHAR* Chars, int32 Length)
+	{
+		uint64 Key = uint64(Length) << 60;
+		for (int32 Index = 0; Index < Length; Index++)
+		{
+			Key |= uint64(Chars[Index] & 0xFFFFF) << (Index * 20);
+		}
+		return Key;
+	}
+}
+
+FGRIDAssetIndex::FGRIDAssetIndex()
+{
+}
+
+FGRIDAssetIndex::~FGRIDAssetIndex()
+{
+	Stop();
+}
+
+void FGRIDAssetIndex::Start()
+{
+	GRIDCheckGameThread(TEXT("FGRIDAssetIndex::Start"));
+	if (bStarted)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FGRIDAssetIndex::OnAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FGRIDAssetIndex::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FGRIDAssetIndex::OnAssetRenamed);
+	bStarted = true;
+
+	if (GEditor)
+	{
+		AssetOpenedHandle = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OnAssetOpenedInEditor().AddRaw(this, &FGRIDAssetIndex::OnAssetOpenedInEditor);
+	}
+
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FGRIDAssetIndex::OnFilesLoaded);
+	}
+	else
+	{
+		Build();
+	}
+}
+
+void FGRIDAssetIndex::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+
+	// The registry may already be gone when the editor shuts down
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+		AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	if (UAssetEditorSubsystem* AssetEditors = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr)
+	{
+		AssetEditors->OnAssetOpenedInEditor().Remove(AssetOpenedHandle);
+	}
+	bStarted = false;
+}
+
+void FGRIDAssetIndex::Find(const FString& Query, const FTopLevelAssetPath& ClassPath, const FString& Folder, TArray<FAssetData>& OutAssets) const
+{
+	const FString LowerQuery = Query.ToLower();
+	FString LowerFolder = Folder.ToLower();
+	if (!LowerFolder.IsEmpty() && !LowerFolder.EndsWith(TEXT("/")))
+	{
+		LowerFolder += TEXT('/');
+	}
+
+	FReadScopeLock ReadLock(Lock);
+
+	// Walk the shortest posting list the query is indexed under, or the class's list, and check each
+	// entry. A one-character query has no postings and matches most names, so it scans
+	const TArray<int32>* Candidates = nullptr;
+	TArray<uint64> Keys;
+	GetQueryKeys(LowerQuery, Keys);
+	for (const uint64 Key : Keys)
+	{
+		const TArray<int32>* Posting = Postings.Find(Key);
+		if (!Posting)
+		{
+			return;
+		}
+		if (!Candidates || Posting->Num() < Candidates->Num())
+		{
+			Candidates = Posting;
+		}
+	}
+	if (!Candidates && ClassPath.IsValid())
+	{
+		Candidates = ByClass.Find(ClassPath);
+		if (!Candidates)
+		{
+			return;
+		}
+	}
+
+	auto Visit = [&](int32 Slot)
+	{
+		const FEntry& Entry = Entries[Slot];
+		if (Entry.bLive
+			&& (LowerQuery.IsEmpty() || Entry.Name.Contains(LowerQuery, ESearchCase::CaseSensitive))
+			&& (!ClassPath.IsValid() || Entry.Asset.AssetClassPath == ClassPath)
+			&& (LowerFolder.IsEmpty() || Entry.Folder.StartsWith(LowerFolder, ESearchCase::CaseSensitive)))
+		{
+			OutAssets.Add(Entry.Asset);
+		}
+	};
+
+	if (Candidates)
+	{
+		for (const int32 Slot : *Candidates)
+		{
+			Visit(Slot);
+		}
+	}
+	else
+	{
+		OutAssets.Reserve(OutAssets.Num() + LiveCount);
+		for (int32 Slot = 0; Slot < Entries.Num(); Slot++)
+		{
+			Visit(Slot);
+		}
+	}
+}
+
+void FGRIDAssetIndex::FindRanked(const FString& Query, const FTopLevelAssetPath& ClassPath, const FString& Folder, const FGRIDAssetRankOptions& Options,
+	int32 MaxResults, TArray<FAssetData>& OutAssets) const
+{
+	if (MaxResults <= 0)
+	{
+		return;
+	}
+
+	const FGRIDFuzzyScorer Scorer(Query);
+	FString LowerFolder = Folder.ToLower();
+	if (!LowerFolder.IsEmpty() && !LowerFolder.EndsWith(TEXT("/")))
+	{
+		LowerFolder += TEXT('/');
+	}
+	FString NearFolder = Options.NearFolder.ToLower();
+	if (!NearFolder.IsEmpty() && !NearFolder.EndsWith(TEXT("/")))
+	{
+		NearFolder += TEXT('/');
+	}
+	const double Now = FPlatformTime::Seconds();
+
+	// Fuzzy matches can't come from the trigram postings, so every entry is scored. The heap holds
+	// the best MaxResults so far with the weakest on top, and most entries only meet the mask test.
+	// Equal scores rank by name, so which ties make the cut doesn't depend on slot order.
+	using FScored = TPair<int32, int32>;
+	auto Weaker = [this](const FScored& A, const FScored& B)
+	{
+		return A.Key != B.Key ? A.Key < B.Key : Entries[A.Value].Name > Entries[B.Value].Name;
+	};
+	TArray<FScored> Best;
+	Best.Reserve(MaxResults + 1);
+
+	FReadScopeLock ReadLock(Lock);
+
+	auto Visit = [&](int32 Slot)
+	{
+		const FEntry& Entry = Entries[Slot];
+		if (!Entry.bLive
+			|| (ClassPath.IsValid() && Entry.Asset.AssetClassPath != ClassPath)
+			|| (!LowerFolder.IsEmpty() && !Entry.Folder.StartsWith(LowerFolder, ESearchCase::CaseSensitive)))
+		{
+			return;
+		}
+
+		int32 Score = Scorer.Score(Entry.Name, Entry.CharMask, Entry.WordStarts);
+		if (Score == INDEX_NONE)
+		{
+			return;
+		}
+		if (Options.PreferredClass.IsValid() && Entry.Asset.AssetClassPath == Options.PreferredClass)
+		{
+			Score += PreferredClassBonus;
+		}
+		if (!NearFolder.IsEmpty())
+		{
+			Score += FMath::Min(CountSharedFolders(Entry.Folder, NearFolder) * FolderBonusPerLevel, MaxFolderBonus);
+		}
+		if (Entry.LastUsedTime > 0.0)
+		{
+			Score += FMath::RoundToInt(RecentUseBonus * FMath::Max(0.0, 1.0 - (Now - Entry.LastUsedTime) / RecentUseSeconds));
+		}
+
+		if (Best.Num() < MaxResults)
+		{
+			Best.HeapPush(FScored(Score, Slot), Weaker);
+		}
+		else if (Weaker(Best.HeapTop(), FScored(Score, Slot)))
+		{
+			Best.HeapPopDiscard(Weaker, EAllowShrinking::No);
+			Best.HeapPush(FScored(Score, Slot), Weaker);
+		}
+	};
+
+	if (const TArray<int32>* Candidates = ClassPath.IsValid() ? ByClass.Find(ClassPath) : nullptr)
+	{
+		for (const int32 Slot : *Candidates)
+		{
+			Visit(Slot);
+		}
+	}
+	else if (!ClassPath.IsValid())
+	{
+		for (int32 Slot = 0; Slot < Entries.Num(); Slot++)
+		{
+			Visit(Slot);
+		}
+	}
+
+	Best.Sort([&Weaker](const FScored& A, const FScored& B) { return Weaker(B, A); });
+	OutAssets.Reserve(OutAssets.Num() + Best.Num());
+	for (const FScored& Scored : Best)
+	{
+		OutAssets.Add(Entries[Scored.Value].Asset);
+	}
+}
+
+void FGRIDAssetIndex::MarkUsed(const FSoftObjectPath& ObjectPath)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	if (const int32* Slot = SlotByPath.Find(ObjectPath))
+	{
+		Entries[*Slot].LastUsedTime = FPlatformTime::Seconds();
+	}
+}
+
+void FGRIDAssetIndex::AddAsset(const FAssetData& Asset)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	const FSoftObjectPath ObjectPath = Asset.GetSoftObjectPath();
+	if (const int32* Existing = SlotByPath.Find(ObjectPath))
+	{
+		RemoveSlot(*Existing);
+	}
+
+	const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	FEntry& Entry = Entries[Slot];
+	Entry.Asset = Asset;
+	Entry.Name = Asset.AssetName.ToString().ToLower();
+	Entry.Folder = Asset.PackagePath.ToString().ToLower() + TEXT('/');
+	Entry.CharMask = FGRIDFuzzyScorer::GetCharMask(Entry.Name);
+	Entry.WordStarts = FGRIDFuzzyScorer::GetWordStarts(Asset.AssetName.ToString());
+	Entry.LastUsedTime = 0.0;
+	Entry.bLive = true;
+
+	TArray<uint64> Keys;
+	GetIndexKeys(Entry.Name, Keys);
+	for (const uint64 Key : Keys)
+	{
+		Postings.FindOrAdd(Key).Add(Slot);
+	}
+	ByClass.FindOrAdd(Asset.AssetClassPath).Add(Slot);
+	SlotByPath.Add(ObjectPath, Slot);
+	LiveCount++;
+}
+
+void FGRIDAssetIndex::RemoveAsset(const FSoftObjectPath& ObjectPath)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	int32 Slot;
+	if (SlotByPath.RemoveAndCopyValue(ObjectPath, Slot))
+	{
+		RemoveSlot(Slot);
+	}
+}
+
+int32 FGRIDAssetIndex::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return LiveCount;
+}
+
+void FGRIDAssetIndex::Reset()
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	bReady = false;
+	Entries.Reset();
+	FreeSlots.Reset();
+	SlotByPath.Reset();
+	Postings.Reset();
+	ByClass.Reset();
+	LiveCount = 0;
+}
+
+void FGRIDAssetIndex::RemoveSlot(int32 Slot)
+{
+	FEntry& Entry = Entries[Slot];
+	SlotByPath.Remove(Entry.Asset.GetSoftObjectPath());
+
+	TArray<uint64> Keys;
+	GetIndexKeys(Entry.Name, Keys);
+	for (const uint64 Key : Keys)
+	{
+		if (TArray<int32>* Posting = Postings.Find(Key))
+		{
+			Posting->RemoveSingleSwap(Slot, EAllowShrinking::No);
+			if (Posting->Num() == 0)
+			{
+				Postings.Remove(Key);
+			}
+		}
+	}
+
+	if (TArray<int32>* Posting = ByClass.Find(Entry.Asset.AssetClassPath))
+	{
+		Posting->RemoveSingleSwap(Slot, EAllowShrinking::No);
+		if (Posting->Num() == 0)
+		{
+			ByClass.Remove(Entry.Asset.AssetClassPath);
+		}
+	}
+
+	Entry = FEntry();
+	FreeSlots.Add(Slot);
+	LiveCount--;
+}
+
+void FGRIDAssetIndex::GetIndexKeys(const FString& Name, TArray<uint64>& OutKeys)
+{
+	const TCHAR* Chars = *Name;
+	const int32 Length = Name.Len();
+	for (int32 Index = 0; Index + 2 <= Length; Index++)
+	{
+		OutKeys.AddUnique(MakeKey(Chars + Index, 2));
+	}
+	for (int32 Index = 0; Index + 3 <= Length; Index++)
+	{
+		OutKeys.AddUnique(MakeKey(Chars + Index, 3));
+	}
+}
+
+void FGRIDAssetIndex::GetQueryKeys(const FString& Query, TArray<uint64>& OutKeys)
+{
+	const TCHAR* Chars = *Query;
+	const int32 Length = Query.Len();
+	if (Length == 2)
+	{
+		OutKeys.Add(MakeKey(Chars, 2));
+		return;
+	}
+	for (int32 Index = 0; Index + 3 <= Length; Index++)
+	{
+		OutKeys.AddUnique(MakeKey(Chars + Index, 3));
+	}
+}
+
+bool FGRIDAssetIndex::CoversFolder(const FString& Folder)
+{
+	return Folder.Equals(TEXT("/Game"), ESearchCase::IgnoreCase) || Folder.StartsWith(TEXT("/Game/"), ESearchCase::IgnoreCase);
+}
+
+void FGRIDAssetIndex::Build()
+{
+	GRIDCheckGameThread(TEXT("FGRIDAssetIndex::Build"));
+
+	const double StartTime = FPlatformTime::Seconds();
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(GameRoot);
+	Filter.bRecursivePaths = true;
+	// Same view as the worker-thread registry fallback in asset_search
+	Filter.bIncludeOnlyOnDiskAssets = true;
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	Reset();
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Entries.Reserve(Assets.Num());
+		SlotByPath.Reserve(Assets.Num());
+	}
+	for (const FAssetData& Asset : Assets)
+	{
+		AddAsset(Asset);
+	}
+	bReady = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[GRID] Asset index built: %d assets in %.1f ms"), Assets.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FGRIDAssetIndex::OnFilesLoaded()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+	}
+	FilesLoadedHandle.Reset();
+	Build();
+}
+
+void FGRIDAssetIndex::OnAssetAdded(const FAssetData& Asset)
+{
+	// Assets found by the initial scan are picked up by Build
+	if (bReady && IsUnderGame(Asset))
+	{
+		AddAsset(Asset);
+	}
+}
+
+void FGRIDAssetIndex::OnAssetRemoved(const FAssetData& Asset)
+{
+	if (bReady)
+	{
+		RemoveAsset(Asset.GetSoftObjectPath());
+	}
+}
+
+void FGRIDAssetIndex::OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+	if (bReady)
+	{
+		RemoveAsset(FSoftObjectPath(OldObjectPath));
+		if (IsUnderGame(Asset))
+		{
+			AddAsset(Asset);
+		}
+	}
+}
+
+void FGRIDAssetIndex::OnAssetOpenedInEditor(UObject* Asset, IAssetEditorInstance* Editor)
+{
+	if (Asset)
+	{
+		MarkUsed(FSoftObjectPath(Asset));
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/BridgeSettings.h"
+#include "Misc/ConfigCacheIni.h"
+
+namespace
+{
+	const TCHAR* SettingsSection = TEXT("/Script/GRIDEditor.GRIDEditorSettings");
+}
+
+FGRIDBridgeSettings FGRIDBridgeSettings::Load()
+{
+	FGRIDBridgeSettings Settings;
+	if (!GConfig)
+	{
+		return Settings;
+	}
+
+	FString ConfigFile;
+	FConfigCacheIni::LoadGlobalIniFile(ConfigFile, TEXT("GRID"));
+
+	GConfig->GetFloat(SettingsSection, TEXT("ConnectionIdleTimeoutSeconds"), Settings.ConnectionIdleTimeoutSeconds, ConfigFile);
+	GConfig->GetInt(SettingsSection, TEXT("MaxConnections"), Settings.MaxConnections, ConfigFile);
+	Settings.MaxConnections = FMath::Max(1, Settings.MaxConnections);
+	GConfig->GetFloat(SettingsSection, TEXT("RequestTimeoutSeconds"), Settings.RequestTimeoutSeconds, ConfigFile);
+	GConfig->GetBool(SettingsSection, TEXT("bEnableUnixSocket"), Settings.bEnableUnixSocket, ConfigFile);
+	GConfig->GetInt(SettingsSection, TEXT("SharedMemoryRingMB"), Settings.SharedMemoryRingMB, ConfigFile);
+	GConfig->GetInt(SettingsSection, TEXT("SharedMemoryThresholdKB"), Settings.SharedMemoryThresholdKB, ConfigFile);
+	GConfig->GetFloat(SettingsSection, TEXT("GameThreadBudgetMs"), Settings.GameThreadBudgetMs, ConfigFile);
+	GConfig->GetFloat(SettingsSection, TEXT("PIEGameThreadBudgetMs"), Settings.PIEGameThreadBudgetMs, ConfigFile);
+	GConfig->GetBool(SettingsSection, TEXT("bDeferBulkDuringPIE"), Settings.bDeferBulkDuringPIE, ConfigFile);
+	GConfig->GetInt(SettingsSection, TEXT("StreamPageSize"), Settings.StreamPageSize, ConfigFile);
+	Settings.StreamPageSize = FMath::Max(1, Settings.StreamPageSize);
+	GConfig->GetInt(SettingsSection, TEXT("MaxInFlightPerConnection"), Settings.MaxInFlightPerConnection, ConfigFile);
+	Settings.MaxInFlightPerConnection = FMath::Max(1, Settings.MaxInFlightPerConnection);
+	GConfig->GetInt(SettingsSection, TEXT("MaxPendingCommands"), Settings.MaxPendingCommands, ConfigFile);
+	Settings.MaxPendingCommands = FMath::Max(1, Settings.MaxPendingCommands);
+	GConfig->GetBool(SettingsSection, TEXT("bKeepEditorAwake"), Settings.bKeepEditorAwake, ConfigFile);
+	GConfig->GetBool(SettingsSection, TEXT("bEnableBenchmarkCommands"), Settings.bEnableBenchmarkCommands, ConfigFile);
+
+	return Settings;
+}
@@ -0,0 +1,104 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/BridgeStats.h"
+#include "Misc/ScopeLock.h"
+
+void FGRIDBridgeStats::FLatency::Add(double Seconds)
+{
+	Count++;
+	TotalSeconds += Seconds;
+	MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridgeStats::FLatency::ToJson() const
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("count"), Count);
+	Result->SetNumberField(TEXT("avg_ms"), Count > 0 ? (TotalSeconds / Count) * 1000.0 : 0.0);
+	Result->SetNumberField(TEXT("max_ms"), MaxSeconds * 1000.0);
+	return Result;
+}
+
+void FGRIDBridgeStats::RecordConnectionOpened()
+{
+	FScopeLock ScopeLock(&Lock);
+	ConnectionsOpened++;
+	ActiveConnections++;
+}
+
+void FGRIDBridgeStats::RecordConnectionClosed(int32 RequestsServed)
+{
+	FScopeLock ScopeLock(&Lock);
+	ActiveConnections = FMath::Max(0, ActiveConnections - 1);
+	RequestsOnClosedConnections += RequestsServed;
+}
+
+void FGRIDBridgeStats::RecordCommand(const FString& CommandType, double LatencySeconds, bool bForeground)
+{
+	FScopeLock ScopeLock(&Lock);
+	Overall.Add(LatencySeconds);
+	(bForeground ? Foreground : Background).Add(LatencySeconds);
+	PerCommand.FindOrAdd(CommandType).Add(LatencySeconds);
+}
+
+void FGRIDBridgeStats::RecordDropped(const FString& CommandType)
+{
+	FScopeLock ScopeLock(&Lock);
+	Dropped++;
+	DroppedPerCommand.FindOrAdd(CommandType)++;
+}
+
+int32 FGRIDBridgeStats::GetActiveConnections() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return ActiveConnections;
+}
+
+void FGRIDBridgeStats::RecordRejected(bool bGlobal)
+{
+	FScopeLock ScopeLock(&Lock);
+	(bGlobal ? RejectedGlobal : RejectedPerConnection)++;
+}
+
+TSharedPtr<FJsonObject> FGRIDBridgeStats::ToJson() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TSharedPtr<FJsonObject> Connections = MakeShared<FJsonObject>();
+	Connections->SetNumberField(TEXT("opened"), ConnectionsOpened);
+	Connections->SetNumberField(TEXT("active"), ActiveConnections);
+	const int64 ClosedConnections = ConnectionsOpened - ActiveConnections;
+	Connections->SetNumberField(TEXT("avg_requests_per_connection"),
+		ClosedConnections > 0 ? static_cast<double>(RequestsOnClosedConnections) / ClosedConnections : 0.0);
+
+	TSharedPtr<FJsonObject> Commands = MakeShared<FJsonObject>();
+	for (const TPair<FString, FLatency>& Pair : PerCommand)
+	{
+		Commands->SetObjectField(Pair.Key, Pair.Value.ToJson());
+	}
+
+	TSharedPtr<FJsonObject> DroppedCommands = MakeShared<FJsonObject>();
+	for (const TPair<FString, int64>& Pair : DroppedPerCommand)
+	{
+		DroppedCommands->SetNumberField(Pair.Key, Pair.Value);
+	}
+
+	TSharedPtr<FJsonObject> DroppedObj = MakeShared<FJsonObject>();
+	DroppedObj->SetNumberField(TEXT("count"), Dropped);
+	DroppedObj->SetObjectField(TEXT("commands"), DroppedCommands);
+
+	TSharedPtr<FJsonObject> Rejected = MakeShared<FJsonObject>();
+	Rejected->SetNumberField(TEXT("count"), RejectedPerConnection + RejectedGlobal);
+	Rejected->SetNumberField(TEXT("per_connection"), RejectedPerConnection);
+	Rejected->SetNumberField(TEXT("global"), RejectedGlobal);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetObjectField(TEXT("connections"), Connections);
+	Result->SetObjectField(TEXT("rejected"), Rejected);
+	Result->SetObjectField(TEXT("dropped"), DroppedObj);
+	Result->SetObjectField(TEXT("latency"), Overall.ToJson());
+	Result->SetObjectField(TEXT("latency_foreground"), Foreground.ToJson());
+	Result->SetObjectField(TEXT("latency_background"), Background.ToJson());
+	Result->SetObjectField(TEXT("commands"), Commands);
+	return Result;
+}
@@ -0,0 +1,44 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/CancellationToken.h"
+
+namespace
+{
+	thread_local const FGRIDCancellationToken* CurrentToken = nullptr;
+}
+
+FGRIDCancellationToken::FGRIDCancellationToken(double InDeadline)
+	: Deadline(InDeadline)
+{
+}
+
+bool FGRIDCancellationToken::IsCancelled() const
+{
+	if (bCancelled)
+	{
+		return true;
+	}
+	const double CurrentDeadline = Deadline;
+	return CurrentDeadline > 0.0 && FPlatformTime::Seconds() >= CurrentDeadline;
+}
+
+const FGRIDCancellationToken* FGRIDCancellationToken::GetCurrent()
+{
+	return CurrentToken;
+}
+
+bool FGRIDCancellationToken::IsCurrentCancelled()
+{
+	return CurrentToken && CurrentToken->IsCancelled();
+}
+
+FGRIDCancellationToken::FScope::FScope(const FGRIDCancellationToken* Token)
+	: Previous(CurrentToken)
+{
+	CurrentToken = Token;
+}
+
+FGRIDCancellationToken::FScope::~FScope()
+{
+	CurrentToken = Previous;
+}
@@ -0,0 +1,243 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/CommandScheduler.h"
+#include "Core/ThreadCheck.h"
+#include "Misc/ScopeLock.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// "stat GRIDBridge" in the editor console, or a CSV capture, shows the bridge's cost per frame
+DECLARE_STATS_GROUP(TEXT("GRID Bridge"), STATGROUP_GRIDBridge, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Bridge Commands"), STAT_GRIDBridgeCommands, STATGROUP_GRIDBridge);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tasks Run"), STAT_GRIDTasksRun, STATGROUP_GRIDBridge);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queue Depth"), STAT_GRIDQueueDepth, STATGROUP_GRIDBridge);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Frame Budget (ms)"), STAT_GRIDFrameBudget, STATGROUP_GRIDBridge);
+
+CSV_DEFINE_CATEGORY(GRIDBridge, true);
+
+FGRIDCommandScheduler::FGRIDCommandScheduler()
+	: FrameBudgetSeconds(0.005)
+	, PIEFrameBudgetSeconds(0.001)
+{
+}
+
+FGRIDCommandScheduler::~FGRIDCommandScheduler()
+{
+	Stop();
+}
+
+void FGRIDCommandScheduler::Start(float InFrameBudgetMs, float InPIEFrameBudgetMs, bool bInDeferBulkDuringPIE)
+{
+	GRIDCheckGameThread(TEXT("FGRIDCommandScheduler::Start"));
+
+	FrameBudgetSeconds = FMath::Max(0.0f, InFrameBudgetMs) / 1000.0;
+	PIEFrameBudgetSeconds = FMath::Max(0.0f, InPIEFrameBudgetMs) / 1000.0;
+	bDeferBulkDuringPIE = bInDeferBulkDuringPIE;
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGRIDCommandScheduler::Tick));
+	}
+}
+
+void FGRIDCommandScheduler::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	for (FLane& Lane : Lanes)
+	{
+		FQueuedTask Queued;
+		while (Lane.Queue.Dequeue(Queued))
+		{
+			Lane.Depth.Decrement();
+		}
+	}
+}
+
+void FGRIDCommandScheduler::SetPlayInEditor(bool bInPlayInEditor)
+{
+	GRIDCheckGameThread(TEXT("FGRIDCommandScheduler::SetPlayInEditor"));
+	bPlayInEditor = bInPlayInEditor;
+}
+
+void FGRIDCommandScheduler::Enqueue(FTask&& Task, EGRIDCommandPriority Priority)
+{
+	FLane& Lane = GetLane(Priority);
+	Lane.Queue.Enqueue({ MoveTemp(Task), FPlatformTime::Seconds() });
+	Lane.Depth.Increment();
+
+	// bTicking is only written on the game thread, so it is only read there
+	if (IsInGameThread() && bTicking)
+	{
+		Lane.QueuedThisFrame++;
+	}
+}
+
+bool FGRIDCommandScheduler::Tick(float DeltaTime)
+{
+	LastTickTime = FPlatformTime::Seconds();
+
+	FLane& Interactive = GetLane(EGRIDCommandPriority::Interactive);
+	FLane& Bulk = GetLane(EGRIDCommandPriority::Bulk);
+	Interactive.QueuedThisFrame = 0;
+	Bulk.QueuedThisFrame = 0;
+
+	// While PIE runs the game's frame rate comes first: a tighter budget, and bulk work can wait
+	const double BudgetSeconds = bPlayInEditor ? PIEFrameBudgetSeconds : FrameBudgetSeconds;
+	const bool bRunBulk = !(bPlayInEditor && bDeferBulkDuringPIE);
+
+	SET_DWORD_STAT(STAT_GRIDQueueDepth, GetQueueDepth());
+	SET_FLOAT_STAT(STAT_GRIDFrameBudget, BudgetSeconds * 1000.0);
+	if (Interactive.Available() == 0 && (!bRunBulk || Bulk.Available() == 0))
+	{
+		// Only reachable with bulk held back for PIE
+		if (Bulk.Available() > 0)
+		{
+			FScopeLock ScopeLock(&StatsLock);
+			PIEFramesBulkDeferred++;
+		}
+		return true;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_GRIDBridgeCommands);
+	const double StartTime = FPlatformTime::Seconds();
+	const double Deadline = StartTime + BudgetSeconds;
+	int32 Ran = 0;
+	int32 MaxDepth = Interactive.Available() + Bulk.Available();
+	double InteractiveWait = 0.0;
+	double BulkWait = 0.0;
+	double InteractiveMaxWait = 0.0;
+	double BulkMaxWait = 0.0;
+	int32 InteractiveRan = 0;
+	int32 BulkRan = 0;
+
+	// Tasks queued by this frame's own tasks (such as the next page of a stream) are left for the
+	// next frame so they yield to the editor in between. Interactive work arriving from the network
+	// meanwhile is picked up before the next bulk task.
+	bTicking = true;
+	for (;;)
+	{
+		const bool bInteractive = Interactive.Available() > 0;
+		if (!bInteractive && (!bRunBulk || Bulk.Available() <= 0))
+		{
+			break;
+		}
+
+		FLane& Lane = bInteractive ? Interactive : Bulk;
+		FQueuedTask Queued;
+		if (!Lane.Queue.Dequeue(Queued))
+		{
+			break;
+		}
+		Lane.Depth.Decrement();
+
+		const double Now = FPlatformTime::Seconds();
+		const double Wait = Now - Queued.EnqueueTime;
+		if (bInteractive)
+		{
+			InteractiveRan++;
+			InteractiveWait += Wait;
+			InteractiveMaxWait = FMath::Max(InteractiveMaxWait, Wait);
+		}
+		else
+		{
+			BulkRan++;
+			BulkWait += Wait;
+			BulkMaxWait = FMath::Max(BulkMaxWait, Wait);
+		}
+
+		Ran++;
+		Queued.Task();
+		Queued.Task.Reset();
+		LastTaskTime = FPlatformTime::Seconds();
+
+		MaxDepth = FMath::Max(MaxDepth, Ran + Interactive.Available() + Bulk.Available());
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+	bTicking = false;
+
+	const double FrameSeconds = FPlatformTime::Seconds() - StartTime;
+	const bool bCarriedOver = Interactive.Available() + Bulk.Available() > 0;
+	INC_DWORD_STAT_BY(STAT_GRIDTasksRun, Ran);
+	CSV_CUSTOM_STAT(GRIDBridge, FrameMs, FrameSeconds * 1000.0, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(GRIDBridge, TasksRun, Ran, ECsvCustomStatOp::Set);
+
+	FScopeLock ScopeLock(&StatsLock);
+	Interactive.TasksRun += InteractiveRan;
+	Interactive.TotalWaitSeconds += InteractiveWait;
+	Interactive.MaxWaitSeconds = FMath::Max(Interactive.MaxWaitSeconds, InteractiveMaxWait);
+	Bulk.TasksRun += BulkRan;
+	Bulk.TotalWaitSeconds += BulkWait;
+	Bulk.MaxWaitSeconds = FMath::Max(Bulk.MaxWaitSeconds, BulkMaxWait);
+	TasksRun += Ran;
+	FramesWithWork++;
+	FramesOverBudget += FrameSeconds > BudgetSeconds ? 1 : 0;
+	FramesCarriedOver += bCarriedOver ? 1 : 0;
+	MaxQueueDepth = FMath::Max(MaxQueueDepth, MaxDepth);
+	LastFrameSeconds = FrameSeconds;
+	TotalFrameSeconds += FrameSeconds;
+	MaxFrameSeconds = FMath::Max(MaxFrameSeconds, FrameSeconds);
+	if (bPlayInEditor)
+	{
+		PIEFramesWithWork++;
+		PIEFramesOverBudget += FrameSeconds > BudgetSeconds ? 1 : 0;
+		PIEFramesBulkDeferred += !bRunBulk && Bulk.Available() > 0 ? 1 : 0;
+		PIETotalFrameSeconds += FrameSeconds;
+		PIEMaxFrameSeconds = FMath::Max(PIEMaxFrameSeconds, FrameSeconds);
+	}
+	return true;
+}
+
+double FGRIDCommandScheduler::GetAverageTaskSeconds() const
+{
+	FScopeLock ScopeLock(&StatsLock);
+	return TasksRun > 0 ? TotalFrameSeconds / TasksRun : 0.0;
+}
+
+TSharedPtr<FJsonObject> FGRIDCommandScheduler::ToJson() const
+{
+	FScopeLock ScopeLock(&StatsLock);
+
+	TSharedPtr<FJsonObject> LaneStats = MakeShared<FJsonObject>();
+	for (const EGRIDCommandPriority Priority : { EGRIDCommandPriority::Interactive, EGRIDCommandPriority::Bulk })
+	{
+		const FLane& Lane = Lanes[static_cast<int32>(Priority)];
+		TSharedPtr<FJsonObject> LaneObj = MakeShared<FJsonObject>();
+		LaneObj->SetNumberField(TEXT("queue_depth"), Lane.Depth.GetValue());
+		LaneObj->SetNumberField(TEXT("tasks_run"), Lane.TasksRun);
+		LaneObj->SetNumberField(TEXT("avg_wait_ms"), Lane.TasksRun > 0 ? (Lane.TotalWaitSeconds / Lane.TasksRun) * 1000.0 : 0.0);
+		LaneObj->SetNumberField(TEXT("max_wait_ms"), Lane.MaxWaitSeconds * 1000.0);
+		LaneStats->SetObjectField(LexToString(Priority), LaneObj);
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("budget_ms"), FrameBudgetSeconds * 1000.0);
+	Result->SetNumberField(TEXT("queue_depth"), GetQueueDepth());
+	Result->SetNumberField(TEXT("max_queue_depth"), MaxQueueDepth);
+	Result->SetNumberField(TEXT("tasks_run"), TasksRun);
+	Result->SetNumberField(TEXT("frames_with_work"), FramesWithWork);
+	Result->SetNumberField(TEXT("frames_over_budget"), FramesOverBudget);
+	Result->SetNumberField(TEXT("frames_carried_over"), FramesCarriedOver);
+	Result->SetNumberField(TEXT("last_frame_ms"), LastFrameSeconds * 1000.0);
+	Result->SetNumberField(TEXT("avg_frame_ms"), FramesWithWork > 0 ? (TotalFrameSeconds / FramesWithWork) * 1000.0 : 0.0);
+	Result->SetNumberField(TEXT("max_frame_ms"), MaxFrameSeconds * 1000.0);
+	Result->SetObjectField(TEXT("lanes"), LaneStats);
+
+	TSharedPtr<FJsonObject> PIE = MakeShared<FJsonObject>();
+	PIE->SetBoolField(TEXT("running"), bPlayInEditor.load());
+	PIE->SetNumberField(TEXT("budget_ms"), PIEFrameBudgetSeconds * 1000.0);
+	PIE->SetBoolField(TEXT("defer_bulk"), bDeferBulkDuringPIE);
+	PIE->SetNumberField(TEXT("frames_with_work"), PIEFramesWithWork);
+	PIE->SetNumberField(TEXT("frames_over_budget"), PIEFramesOverBudget);
+	PIE->SetNumberField(TEXT("frames_bulk_deferred"), PIEFramesBulkDeferred);
+	PIE->SetNumberField(TEXT("avg_frame_ms"), PIEFramesWithWork > 0 ? (PIETotalFrameSeconds / PIEFramesWithWork) * 1000.0 : 0.0);
+	PIE->SetNumberField(TEXT("max_frame_ms"), PIEMaxFrameSeconds * 1000.0);
+	Result->SetObjectField(TEXT("pie"), PIE);
+	return Result;
+}
@@ -0,0 +1,49 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/EditorThrottle.h"
+#include "Editor/EditorPerformanceSettings.h"
+
+FGRIDEditorThrottle::~FGRIDEditorThrottle()
+{
+	Restore();
+}
+
+void FGRIDEditorThrottle::Update(bool bKeepAwake)
+{
+	if (!bKeepAwake)
+	{
+		Restore();
+		return;
+	}
+
+	if (bLifted)
+	{
+		return;
+	}
+
+	// Read each frame by UEditorEngine::ShouldThrottleCPUUsage(); the config file is left alone
+	UEditorPerformanceSettings* PerformanceSettings = GetMutableDefault<UEditorPerformanceSettings>();
+	bSavedThrottle = PerformanceSettings->bThrottleCPUWhenNotForeground;
+	if (bSavedThrottle)
+	{
+		PerformanceSettings->bThrottleCPUWhenNotForeground = false;
+		TimesLifted++;
+		UE_LOG(LogTemp, Verbose, TEXT("[GRID] Lifted background CPU throttling while bridge work is pending"));
+	}
+	bLifted = true;
+}
+
+void FGRIDEditorThrottle::Restore()
+{
+	if (!bLifted)
+	{
+		return;
+	}
+
+	bLifted = false;
+	if (bSavedThrottle && UObjectInitialized())
+	{
+		GetMutableDefault<UEditorPerformanceSettings>()->bThrottleCPUWhenNotForeground = true;
+		UE_LOG(LogTemp, Verbose, TEXT("[GRID] Restored background CPU throttling"));
+	}
+}
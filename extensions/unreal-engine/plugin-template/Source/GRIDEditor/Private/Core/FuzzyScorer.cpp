@@ -0,0 +1,162 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/FuzzyScorer.h"
+
+namespace
+{
+	constexpr int32 MatchScore = 1;
+	constexpr int32 ConsecutiveBonus = 5;
+	constexpr int32 WordStartBonus = 8;
+	constexpr int32 MaxGapPenalty = 3;
+	constexpr int32 PrefixBonus = 15;
+	constexpr int32 ExactBonus = 30;
+
+	/** Letters and digits get a bit each; everything else shares the last one */
+	uint64 GetCharBit(TCHAR Char)
+	{
+		if (Char >= TEXT('a') && Char <= TEXT('z'))
+		{
+			return uint64(1) << (Char - TEXT('a'));
+		}
+		if (Char >= TEXT('0') && Char <= TEXT('9'))
+		{
+			return uint64(1) << (26 + Char - TEXT('0'));
+		}
+		return uint64(1) << 36;
+	}
+
+	bool IsSeparator(TCHAR Char)
+	{
+		return Char == TEXT('_') || Char == TEXT('-') || Char == TEXT(' ') || Char == TEXT('.') || Char == TEXT('/');
+	}
+}
+
+FGRIDFuzzyScorer::FGRIDFuzzyScorer(const FString& InQuery)
+	: Query(InQuery.ToLower())
+	, QueryMask(GetCharMask(Query))
+{
+}
+
+uint64 FGRIDFuzzyScorer::GetCharMask(const FString& LowerName)
+{
+	uint64 Mask = 0;
+	for (const TCHAR Char : LowerName)
+	{
+		Mask |= GetCharBit(Char);
+	}
+	return Mask;
+}
+
+uint64 FGRIDFuzzyScorer::GetWordStarts(const FString& Name)
+{
+	uint64 Starts = 0;
+	const int32 Length = FMath::Min(Name.Len(), 64);
+	for (int32 Index = 0; Index < Length; Index++)
+	{
+		const TCHAR Char = Name[Index];
+		const TCHAR Previous = Index > 0 ? Name[Index - 1] : TEXT('_');
+		if (!IsSeparator(Char)
+			&& (IsSeparator(Previous)
+				|| (FChar::IsUpper(Char) && FChar::IsLower(Previous))
+				|| (FChar::IsDigit(Char) && !FChar::IsDigit(Previous))))
+		{
+			Starts |= uint64(1) << Index;
+		}
+	}
+	return Starts;
+}
+
+int32 FGRIDFuzzyScorer::Score(const FString& LowerName, uint64 CharMask, uint64 WordStarts) const
+{
+	const int32 QueryLength = Query.Len();
+	const int32 NameLength = LowerName.Len();
+	if (QueryLength == 0)
+	{
+		return 0;
+	}
+	if ((QueryMask & ~CharMask) != 0 || QueryLength > NameLength)
+	{
+		return INDEX_NONE;
+	}
+
+	const TCHAR* Name = *LowerName;
+	auto IsWordStart = [WordStarts](int32 Index) { return Index < 64 && (WordStarts >> Index) & 1; };
+
+	int32 Score = 0;
+	int32 Position = 0;
+	int32 Previous = -2;
+	for (int32 QueryIndex = 0; QueryIndex < QueryLength; QueryIndex++)
+	{
+		const TCHAR Char = Query[QueryIndex];
+		const int32 Last = NameLength - (QueryLength - QueryIndex);
+
+		int32 Found = INDEX_NONE;
+		for (int32 Index = Position; Index <= Last; Index++)
+		{
+			if (Name[Index] == Char)
+			{
+				Found = Index;
+				break;
+			}
+		}
+		if (Found == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+
+		// Unless it continues a run, move the match to a later word start when the rest still fits
+		if (Found != Previous + 1 && !IsWordStart(Found))
+		{
+			for (int32 Index = Found + 1; Index <= FMath::Min(Last, 63); Index++)
+			{
+				if (Name[Index] == Char && IsWordStart(Index) && CanMatchRest(Name, NameLength, QueryIndex + 1, Index + 1))
+				{
+					Found = Index;
+					break;
+				}
+			}
+		}
+
+		Score += MatchScore;
+		if (Found == Previous + 1)
+		{
+			Score += ConsecutiveBonus;
+		}
+		else
+		{
+			Score -= FMath::Min(Found - Position, MaxGapPenalty);
+		}
+		if (IsWordStart(Found))
+		{
+			Score += WordStartBonus;
+		}
+
+		Previous = Found;
+		Position = Found + 1;
+	}
+
+	if (Previous == QueryLength - 1)
+	{
+		Score += QueryLength == NameLength ? ExactBonus : PrefixBonus;
+	}
+
+	// Among otherwise equal matches, shorter names come first
+	return Score - (NameLength - QueryLength) / 8;
+}
+
+bool FGRIDFuzzyScorer::CanMatchRest(const TCHAR* Name, int32 NameLength, int32 QueryIndex, int32 From) const
+{
+	for (; QueryIndex < Query.Len(); QueryIndex++)
+	{
+		while (From < NameLength && Name[From] != Query[QueryIndex])
+		{
+			From++;
+		}
+		if (From == NameLength)
+		{
+			return false;
+		}
+		From++;
+	}
+	return true;
+}
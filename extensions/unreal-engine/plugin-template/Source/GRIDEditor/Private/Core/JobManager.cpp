@@ -0,0 +1,190 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/JobManager.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	thread_local FGRIDJob* CurrentJob = nullptr;
+}
+
+const TCHAR* LexToString(EGRIDJobState State)
+{
+	switch (State)
+	{
+	case EGRIDJobState::Queued: return TEXT("queued");
+	case EGRIDJobState::Running: return TEXT("running");
+	case EGRIDJobState::Succeeded: return TEXT("succeeded");
+	case EGRIDJobState::Failed: return TEXT("failed");
+	case EGRIDJobState::Cancelled: return TEXT("cancelled");
+	}
+	return TEXT("unknown");
+}
+
+FGRIDJob::FGRIDJob(const FString& InId, const FString& InCommandType)
+	: Id(InId)
+	, CommandType(InCommandType)
+	, Cancellation(MakeShared<FGRIDCancellationToken>())
+	, CreatedTime(FPlatformTime::Seconds())
+{
+}
+
+EGRIDJobState FGRIDJob::GetState() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return State;
+}
+
+bool FGRIDJob::IsFinished() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return FinishedTime > 0.0;
+}
+
+double FGRIDJob::GetFinishedTime() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return FinishedTime;
+}
+
+TSharedPtr<FJsonObject> FGRIDJob::GetResult() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Result;
+}
+
+void FGRIDJob::MarkRunning()
+{
+	FScopeLock ScopeLock(&Lock);
+	State = EGRIDJobState::Running;
+	StartedTime = FPlatformTime::Seconds();
+}
+
+void FGRIDJob::SetProgress(float InFraction, const FString& InMessage)
+{
+	FScopeLock ScopeLock(&Lock);
+	Progress = FMath::Clamp(InFraction, 0.0f, 1.0f);
+	ProgressMessage = InMessage;
+}
+
+void FGRIDJob::Finish(const TSharedPtr<FJsonObject>& InResult)
+{
+	bool bSuccess = false;
+	FString ErrorCode;
+	if (InResult.IsValid())
+	{
+		InResult->TryGetBoolField(TEXT("success"), bSuccess);
+		InResult->TryGetStringField(TEXT("error_code"), ErrorCode);
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Result = InResult;
+	State = bSuccess ? EGRIDJobState::Succeeded
+		: ErrorCode == TEXT("CANCELLED") ? EGRIDJobState::Cancelled
+		: EGRIDJobState::Failed;
+	Progress = bSuccess ? 1.0f : Progress;
+	FinishedTime = FPlatformTime::Seconds();
+}
+
+TSharedPtr<FJsonObject> FGRIDJob::ToJson() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const double EndTime = FinishedTime > 0.0 ? FinishedTime : FPlatformTime::Seconds();
+	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetStringField(TEXT("job_id"), Id);
+	Json->SetStringField(TEXT("command"), CommandType);
+	Json->SetStringField(TEXT("state"), LexToString(State));
+	Json->SetNumberField(TEXT("progress"), Progress);
+	if (!ProgressMessage.IsEmpty())
+	{
+		Json->SetStringField(TEXT("message"), ProgressMessage);
+	}
+	Json->SetNumberField(TEXT("queued_ms"), ((StartedTime > 0.0 ? StartedTime : EndTime) - CreatedTime) * 1000.0);
+	Json->SetNumberField(TEXT("running_ms"), StartedTime > 0.0 ? (EndTime - StartedTime) * 1000.0 : 0.0);
+	return Json;
+}
+
+void FGRIDJob::ReportProgress(float Fraction, const FString& Message)
+{
+	if (CurrentJob)
+	{
+		CurrentJob->SetProgress(Fraction, Message);
+	}
+}
+
+FGRIDJob::FScope::FScope(FGRIDJob* Job)
+	: Previous(CurrentJob)
+{
+	CurrentJob = Job;
+}
+
+FGRIDJob::FScope::~FScope()
+{
+	CurrentJob = Previous;
+}
+
+TSharedRef<FGRIDJob> FGRIDJobManager::Create(const FString& CommandType)
+{
+	TSharedRef<FGRIDJob> Job = MakeShared<FGRIDJob>(FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower), CommandType);
+
+	FScopeLock ScopeLock(&Lock);
+	RemoveExpired();
+	Jobs.Add(Job->GetId(), Job);
+	return Job;
+}
+
+TSharedPtr<FGRIDJob> FGRIDJobManager::Find(const FString& Id)
+{
+	FScopeLock ScopeLock(&Lock);
+	RemoveExpired();
+	const TSharedRef<FGRIDJob>* Job = Jobs.Find(Id);
+	return Job ? TSharedPtr<FGRIDJob>(*Job) : nullptr;
+}
+
+TArray<TSharedRef<FGRIDJob>> FGRIDJobManager::GetJobs()
+{
+	FScopeLock ScopeLock(&Lock);
+	RemoveExpired();
+	TArray<TSharedRef<FGRIDJob>> Result;
+	Jobs.GenerateValueArray(Result);
+	return Result;
+}
+
+void FGRIDJobManager::CancelAll()
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const TPair<FString, TSharedRef<FGRIDJob>>& Pair : Jobs)
+	{
+		Pair.Value->GetCancellation()->Cancel();
+	}
+}
+
+void FGRIDJobManager::RemoveExpired()
+{
+	// Jobs are added in creation order and TMap keeps insertion order until something is removed,
+	// which is close enough for picking the oldest finished jobs to evict
+	const double Cutoff = FPlatformTime::Seconds() - RetentionSeconds;
+	int32 Finished = 0;
+	for (auto It = Jobs.CreateIterator(); It; ++It)
+	{
+		const double FinishedTime = It.Value()->GetFinishedTime();
+		if (FinishedTime > 0.0 && FinishedTime < Cutoff)
+		{
+			It.RemoveCurrent();
+		}
+		else if (FinishedTime > 0.0)
+		{
+			Finished++;
+		}
+	}
+
+	for (auto It = Jobs.CreateIterator(); It && Finished > MaxFinishedJobs; ++It)
+	{
+		if (It.Value()->IsFinished())
+		{
+			It.RemoveCurrent();
+			Finished--;
+		}
+	}
+}
@@ -0,0 +1,166 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/ObjectCache.h"
+#include "Core/ThreadCheck.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EditorAssetLibrary.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+#include "UObject/PackageReload.h"
+
+FGRIDObjectCache& FGRIDObjectCache::Get()
+{
+	static FGRIDObjectCache Instance;
+	return Instance;
+}
+
+void FGRIDObjectCache::Start()
+{
+	GRIDCheckGameThread(TEXT("FGRIDObjectCache::Start"));
+	if (bStarted)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FGRIDObjectCache::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FGRIDObjectCache::OnAssetRenamed);
+	PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FGRIDObjectCache::OnPackageReloaded);
+	bStarted = true;
+}
+
+void FGRIDObjectCache::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+	bStarted = false;
+	Reset();
+}
+
+UObject* FGRIDObjectCache::LoadAsset(const FString& Path)
+{
+	GRIDCheckGameThread(TEXT("FGRIDObjectCache::LoadAsset"));
+
+	const FString ObjectPath = NormalizePath(Path);
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const TWeakObjectPtr<UObject>* Cached = Entries.Find(ObjectPath))
+		{
+			UObject* Object = Cached->Get();
+			if (IsValid(Object))
+			{
+				Hits++;
+				return Object;
+			}
+		}
+	}
+
+	Misses++;
+	UObject* Object = UEditorAssetLibrary::LoadAsset(Path);
+	if (!Object)
+	{
+		return nullptr;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	if (Entries.Num() >= MaxEntries)
+	{
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (!It.Value().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		if (Entries.Num() >= MaxEntries)
+		{
+			Entries.Reset();
+		}
+	}
+	Entries.Add(ObjectPath, Object);
+	return Object;
+}
+
+void FGRIDObjectCache::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	Entries.Reset();
+}
+
+TSharedPtr<FJsonObject> FGRIDObjectCache::ToJson() const
+{
+	const int64 HitCount = Hits;
+	const int64 MissCount = Misses;
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	{
+		FScopeLock ScopeLock(&Lock);
+		Result->SetNumberField(TEXT("entries"), Entries.Num());
+	}
+	Result->SetNumberField(TEXT("hits"), HitCount);
+	Result->SetNumberField(TEXT("misses"), MissCount);
+	Result->SetNumberField(TEXT("hit_rate"), HitCount + MissCount > 0 ? double(HitCount) / (HitCount + MissCount) : 0.0);
+	Result->SetNumberField(TEXT("invalidations"), Invalidations.load());
+	return Result;
+}
+
+FString FGRIDObjectCache::NormalizePath(const FString& Path)
+{
+	int32 DotIndex;
+	if (Path.FindLastChar(TEXT('.'), DotIndex) && DotIndex > 0 && Path[DotIndex - 1] != TEXT('/'))
+	{
+		return Path;
+	}
+	return Path + TEXT('.') + FPackageName::GetShortName(Path);
+}
+
+void FGRIDObjectCache::Invalidate(const FString& ObjectPath)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Entries.Remove(ObjectPath) > 0)
+	{
+		Invalidations++;
+	}
+}
+
+void FGRIDObjectCache::OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event)
+{
+	if (Phase != EPackageReloadPhase::PrePackageFixup || !Event || !Event->GetOldPackage())
+	{
+		return;
+	}
+
+	// Every asset in the old package is replaced, so drop all entries under it
+	const FString Prefix = Event->GetOldPackage()->GetName() + TEXT('.');
+	FScopeLock ScopeLock(&Lock);
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It.Key().StartsWith(Prefix))
+		{
+			It.RemoveCurrent();
+			Invalidations++;
+		}
+	}
+}
+
+void FGRIDObjectCache::OnAssetRemoved(const FAssetData& Asset)
+{
+	Invalidate(Asset.GetObjectPathString());
+}
+
+void FGRIDObjectCache::OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+	Invalidate(OldObjectPath);
+}
@@ -0,0 +1,35 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "Core/ThreadCheck.h"
+
+namespace
+{
+	thread_local FGRIDThreadCheckScope* CurrentScope = nullptr;
+}
+
+void GRIDCheckGameThread(const TCHAR* Site)
+{
+	if (IsInGameThread())
+	{
+		return;
+	}
+
+	if (CurrentScope)
+	{
+		CurrentScope->Violations.Add(Site);
+		return;
+	}
+
+	checkf(false, TEXT("[GRID] %s must run on the game thread"), Site);
+}
+
+FGRIDThreadCheckScope::FGRIDThreadCheckScope()
+	: Outer(CurrentScope)
+{
+	CurrentScope = this;
+}
+
+FGRIDThreadCheckScope::~FGRIDThreadCheckScope()
+{
+	CurrentScope = Outer;
+}
@@ -2,6 +2,26 @@
 
 #include "Core/ToolRegistry.h"
 
+bool LexTryParseString(EGRIDCommandPriority& OutPriority, const TCHAR* Buffer)
+{
+	if (FCString::Stricmp(Buffer, TEXT("interactive")) == 0)
+	{
+		OutPriority = EGRIDCommandPriority::Interactive;
+		return true;
+	}
+	if (FCString::Stricmp(Buffer, TEXT("bulk")) == 0)
+	{
+		OutPriority = EGRIDCommandPriority::Bulk;
+		return true;
+	}
+	return false;
+}
+
+const TCHAR* LexToString(EGRIDCommandPriority Priority)
+{
+	return Priority == EGRIDCommandPriority::Bulk ? TEXT("bulk") : TEXT("interactive");
+}
+
 FGRIDToolRegistry& FGRIDToolRegistry::Get()
 {
 	static FGRIDToolRegistry Instance;
@@ -23,6 +43,7 @@ void FGRIDToolRegistry::Shutdown()
 	Tools.Empty();
 	ToolNameToIndex.Empty();
 	ToolExecuteFuncs.Empty();
+	Commands.Empty();
 	bInitialized = false;
 }
 
@@ -62,6 +83,65 @@ const FGRIDToolMetadata* FGRIDToolRegistry::FindTool(const FString& ToolName) co
 	return nullptr;
 }
 
+EGRIDThreadAffinity FGRIDToolRegistry::GetThreadAffinity(const FString& ToolName) const
+{
+	const FGRIDCommand* Command = FindCommand(ToolName);
+	return Command ? Command->ThreadAffinity : EGRIDThreadAffinity::GameThread;
+}
+
+EGRIDCommandPriority FGRIDToolRegistry::GetPriority(const FString& ToolName) const
+{
+	const FGRIDCommand* Command = FindCommand(ToolName);
+	return Command ? Command->Priority : EGRIDCommandPriority::Interactive;
+}
+
+void FGRIDToolRegistry::RegisterCommand(const FGRIDToolRegistration& Registration, FGRIDCommandHandler Handler, const void* Owner)
+{
+	RegisterTool(Registration);
+
+	FGRIDCommand& Command = Commands.FindOrAdd(FName(*Registration.Name));
+	Command.Name = Registration.Name;
+	Command.Handler = MoveTemp(Handler);
+	Command.ThreadAffinity = Registration.ThreadAffinity;
+	Command.Priority = Registration.Priority;
+	Command.Owner = Owner;
+}
+
+const FGRIDCommand* FGRIDToolRegistry::FindCommand(const FString& CommandName) const
+{
+	const FName Name(*CommandName, FNAME_Find);
+	const FGRIDCommand* Command = Name.IsNone() ? nullptr : Commands.Find(Name);
+	return Command && Command->Name.Equals(CommandName, ESearchCase::CaseSensitive) ? Command : nullptr;
+}
+
+void FGRIDToolRegistry::RemoveAll(const void* Owner)
+{
+	TSet<FString> Removed;
+	for (auto It = Commands.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Owner == Owner)
+		{
+			Removed.Add(It.Key().ToString());
+			It.RemoveCurrent();
+		}
+	}
+	if (Removed.Num() == 0)
+	{
+		return;
+	}
+
+	Tools.RemoveAll([&Removed](const FGRIDToolMetadata& Tool) { return Removed.Contains(Tool.Name); });
+	ToolNameToIndex.Reset();
+	for (int32 Index = 0; Index < Tools.Num(); Index++)
+	{
+		ToolNameToIndex.Add(Tools[Index].Name, Index);
+	}
+	for (const FString& Name : Removed)
+	{
+		ToolExecuteFuncs.Remove(Name);
+	}
+}
+
 void FGRIDToolRegistry::RegisterTool(const FGRIDToolRegistration& Registration)
 {
 	FGRIDToolMetadata Metadata;
@@ -69,13 +149,22 @@ void FGRIDToolRegistry::RegisterTool(const FGRIDToolRegistration& Registration)
 	Metadata.Description = Registration.Description;
 	Metadata.Category = Registration.Category;
 	Metadata.Parameters = Registration.Parameters;
+	Metadata.ThreadAffinity = Registration.ThreadAffinity;
+	Metadata.Priority = Registration.Priority;
 
-	int32 Index = Tools.Num();
-	Tools.Add(Metadata);
-	ToolNameToIndex.Add(Registration.Name, Index);
+	// Registering a name again replaces the earlier entry, e.g. when the bridge is recreated
+	if (const int32* Existing = ToolNameToIndex.Find(Registration.Name))
+	{
+		Tools[*Existing] = Metadata;
+	}
+	else
+	{
+		ToolNameToIndex.Add(Registration.Name, Tools.Num());
+		Tools.Add(Metadata);
+	}
 	ToolExecuteFuncs.Add(Registration.Name, Registration.ExecuteFunc);
 
-	UE_LOG(LogTemp, Log, TEXT("[GRID] Registered tool: %s"), *Registration.Name);
+	UE_LOG(LogTemp, Verbose, TEXT("[GRID] Registered tool: %s"), *Registration.Name);
 }
 
 bool FGRIDToolRegistry::IsToolEnabled(const FString& ToolName) const
@@ -98,7 +187,7 @@ void FGRIDToolRegistry::SetToolEnabled(const FString& ToolName, bool bEnabled)
 FString FGRIDToolRegistry::ExecuteTool(const FString& ToolName, const TMap<FString, FString>& Parameters)
 {
 	const FGRIDToolExecuteFunc* Func = ToolExecuteFuncs.Find(ToolName);
-	if (!Func)
+	if (!Func || !*Func)
 	{
 		return TEXT("{\"success\":false,\"error_code\":\"UNKNOWN_TOOL\",\"error\":\"Tool not found\"}");
 	}
@@ -0,0 +1,348 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+// Console commands that measure bridge internals inside a running editor.
+// Results are written to the output log.
+
+#include "GRIDMessagePack.h"
+#include "Core/ActorIndex.h"
+#include "Core/AssetIndex.h"
+#include "Core/FuzzyScorer.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Engine/StaticMeshActor.h"
+#include "HAL/IConsoleManager.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	/** Time Body over Iterations runs; returns the average in milliseconds */
+	template <typename FunctionType>
+	double TimeAverageMs(int32 Iterations, FunctionType&& Body)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Body();
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+	}
+
+	/** A response shaped like actor_list for NumActors actors */
+	TSharedPtr<FJsonObject> MakeActorListResponse(int32 NumActors)
+	{
+		FRandomStream Random(NumActors);
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		ActorArray.Reserve(NumActors);
+		for (int32 Index = 0; Index < NumActors; Index++)
+		{
+			TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+			ActorObj->SetStringField(TEXT("name"), FString::Printf(TEXT("StaticMeshActor_%d"), Index));
+			ActorObj->SetStringField(TEXT("class"), TEXT("StaticMeshActor"));
+			ActorObj->SetNumberField(TEXT("x"), Random.FRandRange(-100000.0f, 100000.0f));
+			ActorObj->SetNumberField(TEXT("y"), Random.FRandRange(-100000.0f, 100000.0f));
+			ActorObj->SetNumberField(TEXT("z"), Random.FRandRange(0.0f, 5000.0f));
+			ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
+		}
+
+		TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+		Data->SetArrayField(TEXT("actors"), ActorArray);
+		Data->SetNumberField(TEXT("count"), NumActors);
+
+		TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+		Response->SetBoolField(TEXT("success"), true);
+		Response->SetObjectField(TEXT("data"), Data);
+		return Response;
+	}
+
+	void BenchmarkEncoding(const TArray<FString>& Args)
+	{
+		const int32 NumActors = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 50000;
+		const int32 Iterations = 5;
+		const TSharedPtr<FJsonObject> Response = MakeActorListResponse(NumActors);
+
+		TArray<uint8> JsonBytes;
+		const double JsonEncodeMs = TimeAverageMs(Iterations, [&]()
+		{
+			JsonBytes.Reset();
+			FMemoryWriter Archive(JsonBytes);
+			TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+				TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+			FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+		});
+		const double JsonDecodeMs = TimeAverageMs(Iterations, [&]()
+		{
+			TSharedPtr<FJsonObject> Decoded;
+			TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(
+				FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(JsonBytes.GetData()), JsonBytes.Num()));
+			FJsonSerializer::Deserialize(Reader, Decoded);
+		});
+
+		TArray<uint8> PackedBytes;
+		const double PackEncodeMs = TimeAverageMs(Iterations, [&]()
+		{
+			PackedBytes.Reset();
+			FMemoryWriter Archive(PackedBytes);
+			FGRIDMessagePack::Write(Archive, Response);
+		});
+		const double PackDecodeMs = TimeAverageMs(Iterations, [&]()
+		{
+			FGRIDMessagePack::Read(PackedBytes);
+		});
+
+		UE_LOG(LogTemp, Display, TEXT("[GRID] Encoding benchmark: actor_list with %d actors, average of %d runs"), NumActors, Iterations);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   json:    %10d bytes  encode %8.2f ms  decode %8.2f ms"), JsonBytes.Num(), JsonEncodeMs, JsonDecodeMs);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   msgpack: %10d bytes  encode %8.2f ms  decode %8.2f ms"), PackedBytes.Num(), PackEncodeMs, PackDecodeMs);
+	}
+
+	FAutoConsoleCommand BenchmarkEncodingCommand(
+		TEXT("GRID.Bench.Encoding"),
+		TEXT("Compare JSON and MessagePack size and encode/decode time for an actor_list response. Usage: GRID.Bench.Encoding [NumActors=50000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkEncoding));
+
+	void BenchmarkActorIndex(const TArray<FString>& Args)
+	{
+		const int32 NumActors = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+		const int32 Lookups = 100;
+
+		// A throwaway world, so the benchmark neither touches nor depends on the open level
+		UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("GRIDActorIndexBench"));
+		const FName Tag(TEXT("GRIDBench"));
+		FRandomStream Random(NumActors);
+		for (int32 Index = 0; Index < NumActors; Index++)
+		{
+			const FVector Location(Random.FRandRange(-100000.0f, 100000.0f), Random.FRandRange(-100000.0f, 100000.0f), Random.FRandRange(0.0f, 5000.0f));
+			AActor* Actor = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator);
+			Actor->SetActorLabel(FString::Printf(TEXT("BenchActor_%d"), Index));
+			if (Index % 100 == 0)
+			{
+				Actor->Tags.Add(Tag);
+			}
+		}
+
+		TArray<FString> Labels;
+		TArray<FVector> Points;
+		for (int32 Lookup = 0; Lookup < Lookups; Lookup++)
+		{
+			Labels.Add(FString::Printf(TEXT("BenchActor_%d"), Random.RandHelper(NumActors)));
+			Points.Emplace(Random.FRandRange(-100000.0f, 100000.0f), Random.FRandRange(-100000.0f, 100000.0f), 0.0f);
+		}
+		const double Radius = 5000.0;
+
+		int32 LabelIndex = 0;
+		const double ScanMs = TimeAverageMs(Lookups, [&]()
+		{
+			const FString& Label = Labels[LabelIndex++ % Lookups];
+			for (TActorIterator<AActor> It(World); It; ++It)
+			{
+				if (It->GetActorLabel() == Label)
+				{
+					break;
+				}
+			}
+		});
+
+		int32 PointIndex = 0;
+		int32 SphereScanFound = 0;
+		const double SphereScanMs = TimeAverageMs(Lookups, [&]()
+		{
+			const FVector& Point = Points[PointIndex++ % Lookups];
+			for (TActorIterator<AActor> It(World); It; ++It)
+			{
+				SphereScanFound += FVector::DistSquared(It->GetActorLocation(), Point) <= Radius * Radius ? 1 : 0;
+			}
+		});
+
+		FGRIDActorIndex ActorIndex;
+		const double BuildMs = TimeAverageMs(1, [&]()
+		{
+			TArray<AActor*> Found;
+			ActorIndex.FindByTag(World, Tag, Found);
+		});
+
+		LabelIndex = 0;
+		const double LabelMs = TimeAverageMs(Lookups, [&]()
+		{
+			ActorIndex.FindFirstByLabel(World, Labels[LabelIndex++ % Lookups]);
+		});
+		const double TagMs = TimeAverageMs(Lookups, [&]()
+		{
+			TArray<AActor*> Found;
+			ActorIndex.FindByTag(World, Tag, Found);
+		});
+
+		PointIndex = 0;
+		int32 SphereFound = 0;
+		const double SphereMs = TimeAverageMs(Lookups, [&]()
+		{
+			TArray<AActor*> Found;
+			ActorIndex.QuerySphere(World, Points[PointIndex++ % Lookups], Radius, Found);
+			SphereFound += Found.Num();
+		});
+
+		PointIndex = 0;
+		const double NearestMs = TimeAverageMs(Lookups, [&]()
+		{
+			TArray<TPair<AActor*, double>> Found;
+			ActorIndex.QueryNearest(World, Points[PointIndex++ % Lookups], 10, TNumericLimits<double>::Max(), Found);
+		});
+
+		// Relabelling goes through the editor notification the index listens to
+		AActor* Renamed = ActorIndex.FindFirstByLabel(World, Labels[0]);
+		const double RenameMs = TimeAverageMs(1, [&]()
+		{
+			Renamed->SetActorLabel(TEXT("BenchActor_Renamed"));
+		});
+		const bool bRenameSeen = ActorIndex.FindFirstByLabel(World, TEXT("BenchActor_Renamed")) == Renamed;
+
+		// So does a move finished the way editor tools finish one
+		const FVector MovedTo(500000.0, 500000.0, 0.0);
+		const double MoveMs = TimeAverageMs(1, [&]()
+		{
+			Renamed->SetActorLocation(MovedTo);
+			Renamed->PostEditMove(true);
+		});
+		TArray<AActor*> AtNewLocation;
+		ActorIndex.QuerySphere(World, MovedTo, 100.0, AtNewLocation);
+		const bool bMoveSeen = AtNewLocation.Contains(Renamed);
+
+		UE_LOG(LogTemp, Display, TEXT("[GRID] Actor index benchmark: %d actors, %d lookups"), NumActors, Lookups);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   label scan:   %10.4f ms per lookup"), ScanMs);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   index build:  %10.2f ms"), BuildMs);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   label lookup: %10.4f ms"), LabelMs);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   tag lookup:   %10.4f ms (%d actors)"), TagMs, (NumActors + 99) / 100);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   sphere scan:  %10.4f ms (%.1f actors within %.0f)"), SphereScanMs, double(SphereScanFound) / Lookups, Radius);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   sphere query: %10.4f ms (%.1f actors)"), SphereMs, double(SphereFound) / Lookups);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   nearest 10:   %10.4f ms"), NearestMs);
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   relabel:      %10.4f ms, index updated: %s"), RenameMs, bRenameSeen ? TEXT("yes") : TEXT("no"));
+		UE_LOG(LogTemp, Display, TEXT("[GRID]   move:         %10.4f ms, index updated: %s"), MoveMs, bMoveSeen ? TEXT("yes") : TEXT("no"));
+
+		World->DestroyWorld(false);
+		World->RemoveFromRoot();
+	}
+
+	FAutoConsoleCommand BenchmarkActorIndexCommand(
+		TEXT("GRID.Bench.ActorIndex"),
+		TEXT("Compare scans over every actor with actor index label, tag, sphere and nearest lookups. Usage: GRID.Bench.ActorIndex [NumActors=100000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkActorIndex));
+
+	/** NumAssets registry entries with names and folders shaped like a large project's */
+	TArray<FAssetData> MakeAssets(int32 NumAssets)
+	{
+		static const TCHAR* Prefixes[] = { TEXT("SM"), TEXT("T"), TEXT("M"), TEXT("MI"), TEXT("BP"), TEXT("WBP"), TEXT("SK"), TEXT("A") };
+		static const TCHAR* Words[] = { TEXT("Rock"), TEXT("Tree"), TEXT("Hero"), TEXT("Door"), TEXT("Wall"), TEXT("Crate"), TEXT("Lamp"),
+			TEXT("Grass"), TEXT("Sword"), TEXT("Shield"), TEXT("Enemy"), TEXT("Pickup"), TEXT("Window"), TEXT("Floor"), TEXT("Cliff") };
+		static const TCHAR* Folders[] = { TEXT("Environment"), TEXT("Characters"), TEXT("Props"), TEXT("UI"), TEXT("Weapons"), TEXT("FX") };
+
+		FRandomStream Random(NumAssets);
+		TArray<FAssetData> Assets;
+		Assets.Reserve(NumAssets);
+		for (int32 Index = 0; Index < NumAssets; Index++)
+		{
+			const FString Name = FString::Printf(TEXT("%s_%s%s_%d"), Prefixes[Random.RandHelper(UE_ARRAY_COUNT(Prefixes))],
+				Words[Random.RandHelper(UE_ARRAY_COUNT(Words))], Words[Random.RandHelper(UE_ARRAY_COUNT(Words))], Index);
+			const FString Folder = FString::Printf(TEXT("/Game/%s/%s"), Folders[Random.RandHelper(UE_ARRAY_COUNT(Folders))],
+				Words[Random.RandHelper(UE_ARRAY_COUNT(Words))]);
+			Assets.Emplace(FName(Folder / Name), FName(Folder), FName(Name), FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("StaticMesh")));
+		}
+		return Assets;
+	}
+
+	void BenchmarkAssetIndex(const TArray<FString>& Args)
+	{
+		const int32 NumAssets = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 300000;
+		const int32 Iterations = 20;
+		const TArray<FAssetData> Assets = MakeAssets(NumAssets);
+
+		FGRIDAssetIndex AssetIndex;
+		const double BuildMs = TimeAverageMs(1, [&]()
+		{
+			for (const FAssetData& Asset : Assets)
+			{
+				AssetIndex.AddAsset(Asset);
+			}
+		});
+
+		UE_LOG(LogTemp, Display, TEXT("[GRID] Asset index benchmark: %d assets, average of %d runs, index built in %.1f ms"), NumAssets, Iterations, BuildMs);
+		for (const TCHAR* Query : { TEXT("b"), TEXT("sw"), TEXT("hero"), TEXT("rockdoor"), TEXT("_12345") })
+		{
+			const FString QueryString(Query);
+			int32 ScanMatches = 0;
+			const double ScanMs = TimeAverageMs(Iterations, [&]()
+			{
+				ScanMatches = 0;
+				for (const FAssetData& Asset : Assets)
+				{
+					ScanMatches += Asset.AssetName.ToString().Contains(QueryString) ? 1 : 0;
+				}
+			});
+
+			int32 IndexMatches = 0;
+			const double IndexMs = TimeAverageMs(Iterations, [&]()
+			{
+				TArray<FAssetData> Found;
+				AssetIndex.Find(QueryString, FTopLevelAssetPath(), FString(), Found);
+				IndexMatches = Found.Num();
+			});
+
+			UE_LOG(LogTemp, Display, TEXT("[GRID]   %-10s scan %8.3f ms (%6d)  index %8.3f ms (%6d)"), Query, ScanMs, ScanMatches, IndexMs, IndexMatches);
+		}
+
+		// Fuzzy ranking: scoring every name and sorting all matches, against the index's bounded heap
+		TArray<FString> LowerNames;
+		TArray<uint64> CharMasks;
+		TArray<uint64> WordStarts;
+		for (const FAssetData& Asset : Assets)
+		{
+			const FString Name = Asset.AssetName.ToString();
+			LowerNames.Add(Name.ToLower());
+			CharMasks.Add(FGRIDFuzzyScorer::GetCharMask(LowerNames.Last()));
+			WordStarts.Add(FGRIDFuzzyScorer::GetWordStarts(Name));
+		}
+
+		const int32 TopK = 100;
+		FGRIDAssetRankOptions Options;
+		Options.PreferredClass = FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("StaticMesh"));
+		Options.NearFolder = TEXT("/Game/Characters/Hero");
+		UE_LOG(LogTemp, Display, TEXT("[GRID] Fuzzy ranking benchmark: top %d of %d assets"), TopK, NumAssets);
+		for (const TCHAR* Query : { TEXT("bphero"), TEXT("smrkcl"), TEXT("wbpwin"), TEXT("tgrass12") })
+		{
+			const FGRIDFuzzyScorer Scorer(Query);
+			int32 Matches = 0;
+			const double SortMs = TimeAverageMs(Iterations, [&]()
+			{
+				TArray<TPair<int32, int32>> Scored;
+				for (int32 Index = 0; Index < LowerNames.Num(); Index++)
+				{
+					const int32 Score = Scorer.Score(LowerNames[Index], CharMasks[Index], WordStarts[Index]);
+					if (Score != INDEX_NONE)
+					{
+						Scored.Emplace(Score, Index);
+					}
+				}
+				Scored.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key > B.Key; });
+				Matches = Scored.Num();
+			});
+
+			TArray<FAssetData> Ranked;
+			const double HeapMs = TimeAverageMs(Iterations, [&]()
+			{
+				Ranked.Reset();
+				AssetIndex.FindRanked(Query, FTopLevelAssetPath(), FString(), Options, TopK, Ranked);
+			});
+
+			UE_LOG(LogTemp, Display, TEXT("[GRID]   %-10s score+sort %8.3f ms  top-%d heap %8.3f ms  (%6d matches, best: %s)"), Query, SortMs, TopK, HeapMs,
+				Matches, Ranked.Num() > 0 ? *Ranked[0].AssetName.ToString() : TEXT("none"));
+		}
+	}
+
+	FAutoConsoleCommand BenchmarkAssetIndexCommand(
+		TEXT("GRID.Bench.AssetIndex"),
+		TEXT("Compare a name scan with asset index lookups, and a full sort with top-K fuzzy ranking, on synthetic assets. Usage: GRID.Bench.AssetIndex [NumAssets=300000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkAssetIndex));
+}
@@ -2,12 +2,16 @@
 
 #include "GRIDBridge.h"
 #include "GRIDServerRunnable.h"
+#include "GRIDUnixSocket.h"
 #include "Commands/BlueprintCommands.h"
 #include "Commands/ActorCommands.h"
 #include "Commands/MaterialCommands.h"
 #include "Commands/WidgetCommands.h"
 #include "Commands/AssetCommands.h"
 #include "Commands/InputCommands.h"
+#include "Core/ToolRegistry.h"
+#include "Core/ObjectCache.h"
+#include "Core/ThreadCheck.h"
 
 #include "Sockets.h"
 #include "SocketSubsystem.h"
@@ -18,9 +22,29 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
 #include "Async/Async.h"
+#include "Editor.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersionComparison.h"
+
+namespace
+{
+	/** Holds one slot of MaxPendingCommands while a command is queued or running */
+	struct FAdmissionTicket
+	{
+		explicit FAdmissionTicket(FThreadSafeCounter& InCounter)
+			: Counter(InCounter)
+		{
+		}
+
+		~FAdmissionTicket()
+		{
+			Counter.Decrement();
+		}
+
+		FThreadSafeCounter& Counter;
+	};
+}
 
 FGRIDBridge::FGRIDBridge()
 	: bIsRunning(false)
@@ -35,11 +59,25 @@ FGRIDBridge::FGRIDBridge()
 	WidgetCommands = MakeShared<FWidgetCommands>();
 	AssetCommands = MakeShared<FAssetCommands>();
 	InputCommands = MakeShared<FInputCommands>();
+
+	// Decides which commands get registered; Initialize() loads it again for the rest
+	Settings = FGRIDBridgeSettings::Load();
+	RegisterCommands();
 }
 
 FGRIDBridge::~FGRIDBridge()
 {
 	Shutdown();
+
+	// The dispatch table outlives the bridge; drop handlers bound to it and its command families
+	FGRIDToolRegistry& Registry = FGRIDToolRegistry::Get();
+	Registry.RemoveAll(this);
+	Registry.RemoveAll(BlueprintCommands.Get());
+	Registry.RemoveAll(ActorCommands.Get());
+	Registry.RemoveAll(MaterialCommands.Get());
+	Registry.RemoveAll(WidgetCommands.Get());
+	Registry.RemoveAll(AssetCommands.Get());
+	Registry.RemoveAll(InputCommands.Get());
 }
 
 void FGRIDBridge::Initialize()
@@ -51,6 +89,8 @@ void FGRIDBridge::Initialize()
 
 	UE_LOG(LogTemp, Log, TEXT("[GRID] Bridge initializing..."));
 
+	Settings = FGRIDBridgeSettings::Load();
+
 	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
 	if (!SocketSubsystem)
 	{
@@ -59,7 +99,8 @@ void FGRIDBridge::Initialize()
 	}
 
 	// Create listener socket on dynamic port (0 = OS assigns)
-	ListenerSocket = MakeShareable(SocketSubsystem->CreateSocket(NAME_Stream, TEXT("GRIDListener"), false));
+	// Destroyed explicitly through the socket subsystem in Shutdown()
+	ListenerSocket = MakeShareable(SocketSubsystem->CreateSocket(NAME_Stream, TEXT("GRIDListener"), false), [](FSocket*) {});
 	if (!ListenerSocket.IsValid())
 	{
 		UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to create listener socket"));
@@ -91,16 +132,36 @@ void FGRIDBridge::Initialize()
 		return;
 	}
 
+	CreateUnixListener();
+
 	// Write port file for GRID IDE discovery
 	WritePortFile();
 
+	// Commands run from the scheduler's ticker, so it must be up before requests arrive
+	Scheduler.Start(Settings.GameThreadBudgetMs, Settings.PIEGameThreadBudgetMs, Settings.bDeferBulkDuringPIE);
+	FGRIDObjectCache::Get().Start();
+
+	// Tracked here so the heartbeat never has to ask the game thread
+	bPlayInEditor = GEditor && GEditor->PlayWorld != nullptr;
+	Scheduler.SetPlayInEditor(bPlayInEditor);
+	BeginPIEHandle = FEditorDelegates::BeginPIE.AddRaw(this, &FGRIDBridge::OnBeginPIE);
+	EndPIEHandle = FEditorDelegates::EndPIE.AddRaw(this, &FGRIDBridge::OnEndPIE);
+	EditorStateTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGRIDBridge::TickEditorState));
+
 	// Start server thread
-	ServerRunnable = new FGRIDServerRunnable(this, ListenerSocket);
+	TArray<TSharedPtr<FSocket>> Listeners = { ListenerSocket };
+	if (UnixListenerSocket.IsValid())
+	{
+		Listeners.Add(UnixListenerSocket);
+	}
+	ServerRunnable = new FGRIDServerRunnable(this, MoveTemp(Listeners));
 	ServerThread = FRunnableThread::Create(ServerRunnable, TEXT("GRIDServerThread"), 0, TPri_Normal);
 
 	if (!ServerThread)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to create server thread"));
+		delete ServerRunnable;
+		ServerRunnable = nullptr;
 		Shutdown();
 		return;
 	}
@@ -120,32 +181,53 @@ void FGRIDBridge::Shutdown()
 
 	bIsRunning = false;
 
-	// Stop server runnable
+	// Stop server runnable; the poller wakeup makes this immediate
 	if (ServerRunnable)
 	{
 		ServerRunnable->Stop();
-		FPlatformProcess::Sleep(0.1f);
-	}
-
-	// Close sockets
-	if (ListenerSocket.IsValid())
-	{
-		ListenerSocket->Close();
-		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
-		if (SocketSubsystem)
-		{
-			SocketSubsystem->DestroySocket(ListenerSocket.Get());
-		}
-		ListenerSocket.Reset();
 	}
 
-	// Wait for thread
+	// Wait for thread before closing the listener it watches
 	if (ServerThread)
 	{
 		ServerThread->WaitForCompletion();
 		delete ServerThread;
 		ServerThread = nullptr;
-		ServerRunnable = nullptr;
+	}
+
+	// Releases the poller with its handles and the runnable's references to the listeners.
+	// Its send workers have finished, and late completions see the server gone through its handle
+	delete ServerRunnable;
+	ServerRunnable = nullptr;
+
+	// Nothing is left to answer queued commands; running jobs get the chance to stop early
+	Jobs.CancelAll();
+	Scheduler.Stop();
+	FGRIDObjectCache::Get().Stop();
+	while (ActiveWorkerCommands.GetValue() > 0)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	FEditorDelegates::BeginPIE.Remove(BeginPIEHandle);
+	FEditorDelegates::EndPIE.Remove(EndPIEHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(EditorStateTickerHandle);
+	EditorStateTickerHandle.Reset();
+	Throttle.Restore();
+
+	// Close sockets
+	for (TSharedPtr<FSocket>* Listener : { &ListenerSocket, &UnixListenerSocket })
+	{
+		if (Listener->IsValid())
+		{
+			(*Listener)->Close();
+			ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+			if (SocketSubsystem)
+			{
+				SocketSubsystem->DestroySocket(Listener->Get());
+			}
+			Listener->Reset();
+		}
 	}
 
 	// Delete port file
@@ -154,6 +236,26 @@ void FGRIDBridge::Shutdown()
 	UE_LOG(LogTemp, Log, TEXT("[GRID] Bridge shutdown complete"));
 }
 
+void FGRIDBridge::CreateUnixListener()
+{
+	if (!Settings.bEnableUnixSocket || !FGRIDUnixSocket::IsSupported())
+	{
+		return;
+	}
+
+	// TCP stays available, so a failure here only costs the faster transport
+	const FString SocketPath = FGRIDUnixSocket::GetDefaultPath();
+	FSocket* Listener = FGRIDUnixSocket::CreateListener(SocketPath, 5);
+	if (!Listener)
+	{
+		return;
+	}
+
+	UnixListenerSocket = MakeShareable(Listener, [](FSocket*) {});
+	UnixSocketPath = SocketPath;
+	UE_LOG(LogTemp, Log, TEXT("[GRID] Listening on unix socket %s"), *UnixSocketPath);
+}
+
 void FGRIDBridge::WritePortFile()
 {
 	// Write to Saved/Config/GRID/Port.txt for GRID IDE discovery
@@ -163,6 +265,13 @@ void FGRIDBridge::WritePortFile()
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(PortFilePath));
 
+	// Written first so a client that sees the new port also finds the matching socket path
+	if (!UnixSocketPath.IsEmpty())
+	{
+		SocketFilePath = FPaths::Combine(FPaths::GetPath(PortFilePath), TEXT("Socket.txt"));
+		FFileHelper::SaveStringToFile(UnixSocketPath, *SocketFilePath);
+	}
+
 	FFileHelper::SaveStringToFile(FString::FromInt(Port), *PortFilePath);
 	UE_LOG(LogTemp, Log, TEXT("[GRID] Port file written: %s"), *PortFilePath);
 }
@@ -175,90 +284,545 @@ void FGRIDBridge::DeletePortFile()
 		PlatformFile.DeleteFile(*PortFilePath);
 		UE_LOG(LogTemp, Log, TEXT("[GRID] Port file deleted: %s"), *PortFilePath);
 	}
+
+	if (!SocketFilePath.IsEmpty())
+	{
+		FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*SocketFilePath);
+		SocketFilePath.Empty();
+	}
+
+	if (!UnixSocketPath.IsEmpty())
+	{
+		FGRIDUnixSocket::DeleteSocketFile(UnixSocketPath);
+		UnixSocketPath.Empty();
+	}
+}
+
+void FGRIDBridge::RegisterCommands()
+{
+	FGRIDToolRegistry& Registry = FGRIDToolRegistry::Get();
+
+	// Bridge commands other than batch only read their own thread-safe state
+	Registry.RegisterCommand(this, TEXT("check_connection"), &FGRIDBridge::CheckConnection, TEXT("Bridge"),
+		TEXT("Check the editor is reachable; also negotiates framing, encoding and shared memory"), EGRIDThreadAffinity::AnyThread);
+	Registry.RegisterCommand(this, TEXT("bridge_stats"), &FGRIDBridge::GetBridgeStats, TEXT("Bridge"),
+		TEXT("Connection, latency and scheduler counters"), EGRIDThreadAffinity::AnyThread);
+	if (Settings.bEnableBenchmarkCommands)
+	{
+		Registry.RegisterCommand(this, TEXT("bridge_payload"), &FGRIDBridge::MakePayload, TEXT("Bridge"),
+			TEXT("Return a payload of the requested size, for measuring transfer"), EGRIDThreadAffinity::AnyThread);
+	}
+	Registry.RegisterCommand(this, TEXT("tools_list"), &FGRIDBridge::ListTools, TEXT("Bridge"),
+		TEXT("List every command with its description, parameters and thread affinity"), EGRIDThreadAffinity::AnyThread);
+	Registry.RegisterCommand(this, TEXT("batch"), &FGRIDBridge::RunBatch, TEXT("Bridge"),
+		TEXT("Run a list of commands in order in one game-thread slice"));
+	Registry.RegisterCommand(this, TEXT("job_status"), &FGRIDBridge::GetJobStatus, TEXT("Bridge"),
+		TEXT("Get a background job's state and progress"), EGRIDThreadAffinity::AnyThread,
+		GRID_TOOL_PARAMS(GRID_TOOL_PARAM("job_id", "Id returned when the job was started", "string", true)));
+	Registry.RegisterCommand(this, TEXT("job_result"), &FGRIDBridge::GetJobResult, TEXT("Bridge"),
+		TEXT("Get the response of a finished background job"), EGRIDThreadAffinity::AnyThread,
+		GRID_TOOL_PARAMS(GRID_TOOL_PARAM("job_id", "Id returned when the job was started", "string", true)));
+	Registry.RegisterCommand(this, TEXT("job_cancel"), &FGRIDBridge::CancelJob, TEXT("Bridge"),
+		TEXT("Cancel a background job"), EGRIDThreadAffinity::AnyThread,
+		GRID_TOOL_PARAMS(GRID_TOOL_PARAM("job_id", "Id returned when the job was started", "string", true)));
+	Registry.RegisterCommand(this, TEXT("job_list"), &FGRIDBridge::ListJobs, TEXT("Bridge"),
+		TEXT("List background jobs that are running or recently finished"), EGRIDThreadAffinity::AnyThread);
+
+	BlueprintCommands->RegisterCommands(Registry);
+	ActorCommands->RegisterCommands(Registry);
+	MaterialCommands->RegisterCommands(Registry);
+	WidgetCommands->RegisterCommands(Registry);
+	AssetCommands->RegisterCommands(Registry);
+	InputCommands->RegisterCommands(Registry);
+}
+
+void FGRIDBridge::Dispatch(const FString& CommandType, EGRIDCommandPriority Priority, FGRIDCommandScheduler::FTask&& Task)
+{
+	if (FGRIDToolRegistry::Get().GetThreadAffinity(CommandType) == EGRIDThreadAffinity::AnyThread)
+	{
+		// Keeps registry queries from waiting behind editor work on the game thread
+		ActiveWorkerCommands.Increment();
+		AsyncPool(*GThreadPool, [this, Task = MoveTemp(Task)]() mutable
+		{
+			Task();
+			ActiveWorkerCommands.Decrement();
+		}, nullptr, Priority == EGRIDCommandPriority::Bulk ? EQueuedWorkPriority::Low : EQueuedWorkPriority::Normal);
+		return;
+	}
+
+	Scheduler.Enqueue(MoveTemp(Task), Priority);
+}
+
+EGRIDCommandPriority FGRIDBridge::GetCommandPriority(const FString& CommandType, const TSharedPtr<FJsonObject>& Params) const
+{
+	const FGRIDToolRegistry& Registry = FGRIDToolRegistry::Get();
+	const TArray<TSharedPtr<FJsonValue>>* Commands = nullptr;
+	if (CommandType != TEXT("batch") || !Params.IsValid() || !Params->TryGetArrayField(TEXT("commands"), Commands))
+	{
+		return Registry.GetPriority(CommandType);
+	}
+
+	for (const TSharedPtr<FJsonValue>& Entry : *Commands)
+	{
+		const TSharedPtr<FJsonObject>* Command = nullptr;
+		FString SubCommandType;
+		if (Entry->TryGetObject(Command) && (*Command)->TryGetStringField(TEXT("command"), SubCommandType)
+			&& Registry.GetPriority(SubCommandType) == EGRIDCommandPriority::Bulk)
+		{
+			return EGRIDCommandPriority::Bulk;
+		}
+	}
+	return EGRIDCommandPriority::Interactive;
 }
 
 TSharedPtr<FJsonObject> FGRIDBridge::RouteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
-	// System commands
-	if (CommandType == TEXT("check_connection"))
+	const FGRIDCommand* Command = FGRIDToolRegistry::Get().FindCommand(CommandType);
+	if (!Command)
+	{
+		return CreateErrorResponse(TEXT("UNKNOWN_COMMAND"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+	}
+
+	// Dispatch() only sends AnyThread commands to workers, but batch and jobs call in here too
+	if (Command->ThreadAffinity == EGRIDThreadAffinity::GameThread)
+	{
+		GRIDCheckGameThread(*CommandType);
+	}
+
+	return Command->Handler(Params);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::CheckConnection(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("connected"), true);
+	Result->SetStringField(TEXT("engine_version"), FString::Printf(TEXT("%d.%d"), ENGINE_MAJOR_VERSION, ENGINE_MINOR_VERSION));
+	Result->SetStringField(TEXT("plugin_version"), TEXT("1.0.0"));
+	return CreateSuccessResponse(Result);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::Heartbeat() const
+{
+	const double Now = FPlatformTime::Seconds();
+	const double LastTickTime = Scheduler.GetLastTickTime();
+	const double LastTaskTime = Scheduler.GetLastTaskTime();
+
+	// A growing since_last_tick_ms means the editor is stuck in a long frame (map load, shader
+	// compile), not that the bridge is gone; the reply itself proves the server thread is alive
+	TSharedPtr<FJsonObject> GameThread = MakeShared<FJsonObject>();
+	GameThread->SetNumberField(TEXT("since_last_tick_ms"), LastTickTime > 0.0 ? (Now - LastTickTime) * 1000.0 : -1.0);
+	GameThread->SetNumberField(TEXT("since_last_task_ms"), LastTaskTime > 0.0 ? (Now - LastTaskTime) * 1000.0 : -1.0);
+	GameThread->SetNumberField(TEXT("queue_depth"), Scheduler.GetQueueDepth());
+	GameThread->SetBoolField(TEXT("pie_running"), bPlayInEditor);
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetBoolField(TEXT("alive"), true);
+	Data->SetObjectField(TEXT("game_thread"), GameThread);
+	return CreateSuccessResponse(Data);
+}
+
+bool FGRIDBridge::TickEditorState(float DeltaTime)
+{
+	bEditorForeground = FApp::HasFocus();
+
+	// A connected client may send a command at any moment; lifting the throttle only once it is
+	// queued would leave that command waiting for a slow background frame
+	const double Now = FPlatformTime::Seconds();
+	if (Stats.GetActiveConnections() > 0 || Scheduler.GetQueueDepth() > 0 || ActiveWorkerCommands.GetValue() > 0)
+	{
+		LastBusyTime = Now;
+	}
+	Throttle.Update(Settings.bKeepEditorAwake && LastBusyTime > 0.0 && Now - LastBusyTime < 1.0);
+	return true;
+}
+
+void FGRIDBridge::OnBeginPIE(const bool bIsSimulating)
+{
+	bPlayInEditor = true;
+	Scheduler.SetPlayInEditor(true);
+}
+
+void FGRIDBridge::OnEndPIE(const bool bIsSimulating)
+{
+	bPlayInEditor = false;
+	Scheduler.SetPlayInEditor(false);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::GetBridgeStats(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Data = Stats.ToJson();
+	Data->SetObjectField(TEXT("scheduler"), Scheduler.ToJson());
+	Data->SetObjectField(TEXT("object_cache"), FGRIDObjectCache::Get().ToJson());
+
+	TSharedPtr<FJsonObject> ThrottleObj = MakeShared<FJsonObject>();
+	ThrottleObj->SetBoolField(TEXT("enabled"), Settings.bKeepEditorAwake);
+	ThrottleObj->SetBoolField(TEXT("lifted"), Throttle.IsLifted());
+	ThrottleObj->SetNumberField(TEXT("times_lifted"), Throttle.GetTimesLifted());
+	ThrottleObj->SetBoolField(TEXT("editor_foreground"), bEditorForeground);
+	Data->SetObjectField(TEXT("background_throttle"), ThrottleObj);
+	return CreateSuccessResponse(Data);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::MakePayload(const TSharedPtr<FJsonObject>& Params)
+{
+	// Synthetic response of the requested size, for measuring bulk transfer
+	int32 SizeBytes = 0;
+	Params->TryGetNumberField(TEXT("size"), SizeBytes);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("payload"), FString::ChrN(FMath::Clamp(SizeBytes, 0, 64 * 1024 * 1024), TEXT('x')));
+	return CreateSuccessResponse(Result);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::ListTools(const TSharedPtr<FJsonObject>& Params)
+{
+	FString Category;
+	Params->TryGetStringField(TEXT("category"), Category);
+
+	const FGRIDToolRegistry& Registry = FGRIDToolRegistry::Get();
+	TArray<TSharedPtr<FJsonValue>> ToolArray;
+	for (const FGRIDToolMetadata& Tool : Registry.GetAllTools())
 	{
-		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-		Result->SetBoolField(TEXT("connected"), true);
-		Result->SetStringField(TEXT("engine_version"), TEXT("5.5"));
-		Result->SetStringField(TEXT("plugin_version"), TEXT("1.0.0"));
-		return CreateSuccessResponse(Result);
+		if (!Category.IsEmpty() && Tool.Category != Category)
+		{
+			continue;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ParameterArray;
+		for (const FGRIDToolParameter& Parameter : Tool.Parameters)
+		{
+			TSharedPtr<FJsonObject> ParameterObj = MakeShared<FJsonObject>();
+			ParameterObj->SetStringField(TEXT("name"), Parameter.Name);
+			ParameterObj->SetStringField(TEXT("description"), Parameter.Description);
+			ParameterObj->SetStringField(TEXT("type"), Parameter.Type);
+			ParameterObj->SetBoolField(TEXT("required"), Parameter.bRequired);
+			ParameterArray.Add(MakeShared<FJsonValueObject>(ParameterObj));
+		}
+
+		TSharedPtr<FJsonObject> ToolObj = MakeShared<FJsonObject>();
+		ToolObj->SetStringField(TEXT("name"), Tool.Name);
+		ToolObj->SetStringField(TEXT("description"), Tool.Description);
+		ToolObj->SetStringField(TEXT("category"), Tool.Category);
+		ToolObj->SetBoolField(TEXT("thread_safe"), Tool.ThreadAffinity == EGRIDThreadAffinity::AnyThread);
+		ToolObj->SetStringField(TEXT("priority"), LexToString(Tool.Priority));
+		ToolObj->SetBoolField(TEXT("enabled"), Registry.IsToolEnabled(Tool.Name));
+		ToolObj->SetArrayField(TEXT("parameters"), ParameterArray);
+		ToolArray.Add(MakeShared<FJsonValueObject>(ToolObj));
 	}
 
-	// Blueprint commands
-	if (CommandType.StartsWith(TEXT("blueprint_")))
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetArrayField(TEXT("tools"), ToolArray);
+	Data->SetNumberField(TEXT("count"), ToolArray.Num());
+	return CreateSuccessResponse(Data);
+}
+
+TSharedPtr<void> FGRIDBridge::TryAdmit()
+{
+	if (PendingCommands.Increment() > Settings.MaxPendingCommands)
 	{
-		return BlueprintCommands->HandleCommand(CommandType, Params);
+		PendingCommands.Decrement();
+		Stats.RecordRejected(true);
+		return nullptr;
 	}
 
-	// Actor commands
-	if (CommandType.StartsWith(TEXT("actor_")))
+	// The bridge drops or waits for every queued and running command before it is destroyed
+	return MakeShared<FAdmissionTicket>(PendingCommands);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::CreateBusyResponse(const FString& ErrorMessage, int32 Backlog) const
+{
+	const double AverageTaskMs = Scheduler.GetAverageTaskSeconds() * 1000.0;
+	const int32 RetryAfterMs = FMath::Clamp(FMath::CeilToInt(Backlog * AverageTaskMs), 50, 5000);
+
+	TSharedPtr<FJsonObject> Response = CreateErrorResponse(TEXT("BUSY"), ErrorMessage);
+	Response->SetNumberField(TEXT("retry_after_ms"), RetryAfterMs);
+	return Response;
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::StartJob(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TOptional<EGRIDCommandPriority> Priority)
+{
+	TSharedPtr<void> Ticket = TryAdmit();
+	if (!Ticket.IsValid())
 	{
-		return ActorCommands->HandleCommand(CommandType, Params);
+		return CreateBusyResponse(TEXT("Too many commands pending; retry later"), Scheduler.GetQueueDepth());
 	}
 
-	// Material commands
-	if (CommandType.StartsWith(TEXT("material_")))
+	UE_LOG(LogTemp, Log, TEXT("[GRID] Starting job: %s"), *CommandType);
+
+	const TSharedRef<FGRIDJob> Job = Jobs.Create(CommandType);
+	const EGRIDCommandPriority Lane = Priority.IsSet() ? Priority.GetValue() : GetCommandPriority(CommandType, Params);
+	Dispatch(CommandType, Lane, [this, CommandType, Params, Job, Ticket]()
 	{
-		return MaterialCommands->HandleCommand(CommandType, Params);
+		if (Job->GetCancellation()->IsCancelled())
+		{
+			Stats.RecordDropped(CommandType);
+			Job->Finish(CreateErrorResponse(TEXT("CANCELLED"), TEXT("Job was cancelled before it ran")));
+			return;
+		}
+
+		Job->MarkRunning();
+		const double StartTime = FPlatformTime::Seconds();
+		TSharedPtr<FJsonObject> Result;
+		{
+			FGRIDCancellationToken::FScope CancellationScope(&Job->GetCancellation().Get());
+			FGRIDJob::FScope JobScope(&Job.Get());
+			Result = RouteCommand(CommandType, Params);
+		}
+		Stats.RecordCommand(CommandType, FPlatformTime::Seconds() - StartTime, bEditorForeground);
+		Job->Finish(Result.IsValid() ? Result : CreateErrorResponse(TEXT("INTERNAL_ERROR"), TEXT("Command produced no response")));
+	});
+
+	return CreateSuccessResponse(Job->ToJson());
+}
+
+TSharedPtr<FGRIDJob> FGRIDBridge::FindJob(const TSharedPtr<FJsonObject>& Params, TSharedPtr<FJsonObject>& OutError)
+{
+	FString JobId;
+	if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+	{
+		OutError = CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("Missing 'job_id'"));
+		return nullptr;
+	}
+
+	TSharedPtr<FGRIDJob> Job = Jobs.Find(JobId);
+	if (!Job.IsValid())
+	{
+		OutError = CreateErrorResponse(TEXT("NOT_FOUND"), FString::Printf(TEXT("Unknown or expired job: %s"), *JobId));
+	}
+	return Job;
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::GetJobStatus(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Error;
+	const TSharedPtr<FGRIDJob> Job = FindJob(Params, Error);
+	return Job.IsValid() ? CreateSuccessResponse(Job->ToJson()) : Error;
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::GetJobResult(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Error;
+	const TSharedPtr<FGRIDJob> Job = FindJob(Params, Error);
+	if (!Job.IsValid())
+	{
+		return Error;
 	}
 
-	// Widget commands
-	if (CommandType.StartsWith(TEXT("widget_")))
+	const TSharedPtr<FJsonObject> Result = Job->GetResult();
+	if (!Result.IsValid())
 	{
-		return WidgetCommands->HandleCommand(CommandType, Params);
+		return CreateErrorResponse(TEXT("JOB_PENDING"), FString::Printf(TEXT("Job is still %s"), LexToString(Job->GetState())));
 	}
 
-	// Asset commands
-	if (CommandType.StartsWith(TEXT("asset_")))
+	// A copy, since the reply is tagged with the request id and the result may be fetched again
+	return MakeShared<FJsonObject>(*Result);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::CancelJob(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Error;
+	const TSharedPtr<FGRIDJob> Job = FindJob(Params, Error);
+	if (!Job.IsValid())
 	{
-		return AssetCommands->HandleCommand(CommandType, Params);
+		return Error;
 	}
 
-	// Input commands
-	if (CommandType.StartsWith(TEXT("input_")))
+	Job->GetCancellation()->Cancel();
+	TSharedPtr<FJsonObject> Data = Job->ToJson();
+	Data->SetBoolField(TEXT("cancelled"), !Job->IsFinished());
+	return CreateSuccessResponse(Data);
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::ListJobs(const TSharedPtr<FJsonObject>& Params)
+{
+	TArray<TSharedPtr<FJsonValue>> JobArray;
+	for (const TSharedRef<FGRIDJob>& Job : Jobs.GetJobs())
 	{
-		return InputCommands->HandleCommand(CommandType, Params);
+		JobArray.Add(MakeShared<FJsonValueObject>(Job->ToJson()));
 	}
 
-	return CreateErrorResponse(TEXT("UNKNOWN_COMMAND"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetArrayField(TEXT("jobs"), JobArray);
+	Data->SetNumberField(TEXT("count"), JobArray.Num());
+	return CreateSuccessResponse(Data);
 }
 
-FString FGRIDBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FGRIDBridge::ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FGRIDCancellationToken>& Cancellation,
+	TOptional<EGRIDCommandPriority> Priority, FGRIDCommandCallback OnComplete, FGRIDChunkCallback OnChunk)
 {
+	// Rejected before anything is queued, so an aggressive client costs the editor only this check
+	TSharedPtr<void> Ticket = TryAdmit();
+	if (!Ticket.IsValid())
+	{
+		OnComplete(CreateBusyResponse(TEXT("Too many commands pending; retry later"), Scheduler.GetQueueDepth()));
+		return;
+	}
+
+	// The callback travels with the command's tasks, including every page of a stream, and
+	// releases the ticket once the last of them is done with it
+	OnComplete = [Ticket, Inner = MoveTemp(OnComplete)](const TSharedPtr<FJsonObject>& Response)
+	{
+		Inner(Response);
+	};
+
 	UE_LOG(LogTemp, Log, TEXT("[GRID] Executing command: %s"), *CommandType);
 
-	TPromise<FString> Promise;
-	TFuture<FString> Future = Promise.GetFuture();
+	const double StartTime = FPlatformTime::Seconds();
+	const EGRIDCommandPriority Lane = Priority.IsSet() ? Priority.GetValue() : GetCommandPriority(CommandType, Params);
 
-	// Execute on game thread
-	AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+	bool bStream = false;
+	if (OnChunk && Params.IsValid() && Params->TryGetBoolField(TEXT("stream"), bStream) && bStream)
 	{
-		TSharedPtr<FJsonObject> Result = RouteCommand(CommandType, Params);
+		// Pages are requested with a copy of the params so the caller's object is never modified
+		TSharedPtr<FJsonObject> PageParams = MakeShared<FJsonObject>(*Params);
+		if (!PageParams->HasField(TEXT("limit")))
+		{
+			PageParams->SetNumberField(TEXT("limit"), Settings.StreamPageSize);
+		}
+		Dispatch(CommandType, Lane, [this, CommandType, PageParams, Cancellation, Lane, OnComplete = MoveTemp(OnComplete), OnChunk = MoveTemp(OnChunk), StartTime]() mutable
+		{
+			RunStreamPage(CommandType, PageParams, Cancellation, Lane, MoveTemp(OnComplete), MoveTemp(OnChunk), StartTime);
+		});
+		return;
+	}
 
-		FString ResultString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-		FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
+	// Execute on game thread within the bridge frame budget; the caller serializes and sends the response elsewhere
+	Dispatch(CommandType, Lane, [this, CommandType, Params, Cancellation, OnComplete = MoveTemp(OnComplete), StartTime]()
+	{
+		if (DropIfCancelled(CommandType, Cancellation, OnComplete))
+		{
+			return;
+		}
 
-		Promise.SetValue(ResultString);
+		FGRIDCancellationToken::FScope CancellationScope(Cancellation.Get());
+		TSharedPtr<FJsonObject> Result = RouteCommand(CommandType, Params);
+		Stats.RecordCommand(CommandType, FPlatformTime::Seconds() - StartTime, bEditorForeground);
+		OnComplete(Result);
 	});
+}
+
+TSharedPtr<FJsonObject> FGRIDBridge::RunBatch(const TSharedPtr<FJsonObject>& Params)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Commands = nullptr;
+	if (!Params->TryGetArrayField(TEXT("commands"), Commands))
+	{
+		return CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("Missing 'commands' array"));
+	}
+
+	bool bStopOnError = false;
+	Params->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+	// Every subcommand runs here, in the same game-thread slice, in order
+	TArray<TSharedPtr<FJsonValue>> Results;
+	Results.Reserve(Commands->Num());
+	int32 Failed = 0;
+	bool bCancelled = false;
+	for (const TSharedPtr<FJsonValue>& Entry : *Commands)
+	{
+		// The rest of a batch is skipped once its caller has given up on it
+		if (FGRIDCancellationToken::IsCurrentCancelled())
+		{
+			bCancelled = true;
+			break;
+		}
+
+		const TSharedPtr<FJsonObject>* Command = nullptr;
+		FString SubCommandType;
+		TSharedPtr<FJsonObject> Result;
+		if (!Entry->TryGetObject(Command) || !(*Command)->TryGetStringField(TEXT("command"), SubCommandType))
+		{
+			Result = CreateErrorResponse(TEXT("INVALID_MESSAGE"), TEXT("Batch entry needs a 'command' field"));
+		}
+		else if (SubCommandType == TEXT("batch"))
+		{
+			Result = CreateErrorResponse(TEXT("INVALID_MESSAGE"), TEXT("Batches cannot be nested"));
+		}
+		else
+		{
+			const TSharedPtr<FJsonObject>* SubParams = nullptr;
+			Result = RouteCommand(SubCommandType, (*Command)->TryGetObjectField(TEXT("params"), SubParams) ? *SubParams : MakeShared<FJsonObject>());
+		}
+
+		if (!Result.IsValid())
+		{
+			Result = CreateErrorResponse(TEXT("INTERNAL_ERROR"), TEXT("Command produced no response"));
+		}
+		bool bSuccess = false;
+		if (!Result->TryGetBoolField(TEXT("success"), bSuccess) || !bSuccess)
+		{
+			Failed++;
+		}
+		Results.Add(MakeShared<FJsonValueObject>(Result));
+		FGRIDJob::ReportProgress(static_cast<float>(Results.Num()) / Commands->Num(),
+			FString::Printf(TEXT("%d of %d commands"), Results.Num(), Commands->Num()));
+
+		if (!bSuccess && bStopOnError)
+		{
+			break;
+		}
+	}
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetArrayField(TEXT("results"), Results);
+	Data->SetNumberField(TEXT("count"), Results.Num());
+	Data->SetNumberField(TEXT("failed"), Failed);
+	Data->SetBoolField(TEXT("stopped"), Results.Num() < Commands->Num());
+	Data->SetBoolField(TEXT("cancelled"), bCancelled);
+	return CreateSuccessResponse(Data);
+}
+
+bool FGRIDBridge::DropIfCancelled(const FString& CommandType, const TSharedPtr<FGRIDCancellationToken>& Cancellation, const FGRIDCommandCallback& OnComplete)
+{
+	if (!Cancellation.IsValid() || !Cancellation->IsCancelled())
+	{
+		return false;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("[GRID] Dropped cancelled command: %s"), *CommandType);
+	Stats.RecordDropped(CommandType);
+	OnComplete(CreateErrorResponse(TEXT("CANCELLED"), TEXT("Request was cancelled or expired before it ran")));
+	return true;
+}
+
+void FGRIDBridge::RunStreamPage(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FGRIDCancellationToken>& Cancellation,
+	EGRIDCommandPriority Priority, FGRIDCommandCallback OnComplete, FGRIDChunkCallback OnChunk, double StartTime)
+{
+	if (DropIfCancelled(CommandType, Cancellation, OnComplete))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Result;
+	{
+		FGRIDCancellationToken::FScope CancellationScope(Cancellation.Get());
+		Result = RouteCommand(CommandType, Params);
+	}
 
-	// Wait for result with timeout
-	bool bReady = Future.WaitFor(FTimespan::FromSeconds(30));
-	if (!bReady)
+	const TSharedPtr<FJsonObject>* Data = nullptr;
+	FString NextCursor;
+	const bool bMore = Result.IsValid() && Result->TryGetObjectField(TEXT("data"), Data)
+		&& (*Data)->TryGetStringField(TEXT("next_cursor"), NextCursor);
+	if (!bMore)
 	{
-		TSharedPtr<FJsonObject> TimeoutError = CreateErrorResponse(TEXT("TIMEOUT"), TEXT("Command execution timed out"));
-		FString ErrorString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ErrorString);
-		FJsonSerializer::Serialize(TimeoutError.ToSharedRef(), Writer);
-		return ErrorString;
+		Stats.RecordCommand(CommandType, FPlatformTime::Seconds() - StartTime, bEditorForeground);
+		OnComplete(Result);
+		return;
 	}
 
-	return Future.Get();
+	if (!OnChunk(Result))
+	{
+		// The request was answered some other way, e.g. timed out; stop producing pages
+		Stats.RecordCommand(CommandType, FPlatformTime::Seconds() - StartTime, bEditorForeground);
+		return;
+	}
+
+	// Later pages run as separate tasks so the editor ticks between them
+	TSharedPtr<FJsonObject> NextParams = MakeShared<FJsonObject>(*Params);
+	NextParams->SetStringField(TEXT("cursor"), NextCursor);
+	Dispatch(CommandType, Priority, [this, CommandType, NextParams, Cancellation, Priority, OnComplete = MoveTemp(OnComplete), OnChunk = MoveTemp(OnChunk), StartTime]() mutable
+	{
+		RunStreamPage(CommandType, NextParams, Cancellation, Priority, MoveTemp(OnComplete), MoveTemp(OnChunk), StartTime);
+	});
 }
 
 TSharedPtr<FJsonObject> FGRIDBridge::CreateErrorResponse(const FString& ErrorCode, const FString& ErrorMessage)
@@ -0,0 +1,365 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "GRIDConnection.h"
+#include "GRIDSharedRing.h"
+#include "GRIDMessagePack.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	constexpr int32 FrameHeaderSize = 4;
+	constexpr int32 MinRecvChunk = 64 * 1024;
+
+	bool IsJsonWhitespace(uint8 Char)
+	{
+		return Char == ' ' || Char == '\t' || Char == '\r' || Char == '\n';
+	}
+
+	/** Archive writing into a fixed span of memory; flags an error instead of overflowing */
+	class FSpanWriter : public FArchive
+	{
+	public:
+		FSpanWriter(uint8* InData, int64 InCapacity)
+			: Data(InData)
+			, Capacity(InCapacity)
+			, Num(0)
+		{
+			SetIsSaving(true);
+		}
+
+		virtual void Serialize(void* V, int64 Length) override
+		{
+			if (IsError() || Num + Length > Capacity)
+			{
+				SetError();
+				return;
+			}
+			FMemory::Memcpy(Data + Num, V, Length);
+			Num += Length;
+		}
+
+		virtual int64 Tell() override { return Num; }
+		virtual FString GetArchiveName() const override { return TEXT("FSpanWriter"); }
+
+	private:
+		uint8* Data;
+		int64 Capacity;
+		int64 Num;
+	};
+
+}
+
+FGRIDConnection::FGRIDConnection(FSocket* InSocket)
+	: Socket(InSocket)
+	, Framing(EGRIDFraming::Legacy)
+	, Encoding(EGRIDEncoding::Json)
+	, bProtocolError(false)
+	, ReadOffset(0)
+	, PendingMessageEnd(INDEX_NONE)
+	, LegacyScanOffset(0)
+	, LegacyDepth(0)
+	, bLegacyInString(false)
+	, bLegacyEscape(false)
+	, BulkThreshold(0)
+{
+}
+
+FGRIDConnection::~FGRIDConnection()
+{
+}
+
+bool FGRIDConnection::ReceiveAvailable()
+{
+	// Compact consumed bytes so the buffer is reused instead of growing
+	if (ReadOffset > 0)
+	{
+		RecvBuffer.RemoveAt(0, ReadOffset, EAllowShrinking::No);
+		LegacyScanOffset = FMath::Max(0, LegacyScanOffset - ReadOffset);
+		ReadOffset = 0;
+		PendingMessageEnd = INDEX_NONE;
+	}
+
+	uint32 PendingSize = 0;
+	Socket->HasPendingData(PendingSize);
+	const int32 ChunkSize = FMath::Max<int32>(MinRecvChunk, static_cast<int32>(FMath::Min<uint32>(PendingSize, MaxMessageSize)));
+
+	const int32 Used = RecvBuffer.Num();
+	RecvBuffer.SetNumUninitialized(Used + ChunkSize, EAllowShrinking::No);
+
+	int32 BytesRead = 0;
+	const bool bReceived = Socket->Recv(RecvBuffer.GetData() + Used, ChunkSize, BytesRead);
+	RecvBuffer.SetNum(Used + FMath::Max(0, BytesRead), EAllowShrinking::No);
+
+	// Recv fails on a graceful close (zero bytes) and on errors; a would-block read succeeds with nothing
+	return bReceived;
+}
+
+bool FGRIDConnection::TryGetMessage(FUtf8StringView& OutMessage)
+{
+	if (bProtocolError)
+	{
+		return false;
+	}
+
+	return Framing == EGRIDFraming::LengthPrefixed ? TryGetFramedMessage(OutMessage) : TryGetLegacyMessage(OutMessage);
+}
+
+void FGRIDConnection::ConsumeMessage()
+{
+	if (PendingMessageEnd == INDEX_NONE)
+	{
+		return;
+	}
+
+	ReadOffset = PendingMessageEnd;
+	PendingMessageEnd = INDEX_NONE;
+
+	LegacyScanOffset = ReadOffset;
+	LegacyDepth = 0;
+	bLegacyInString = false;
+	bLegacyEscape = false;
+}
+
+TSharedPtr<FJsonObject> FGRIDConnection::DecodeMessage(FUtf8StringView Message) const
+{
+	if (Encoding == EGRIDEncoding::MessagePack)
+	{
+		return FGRIDMessagePack::Read(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Message.GetData()), Message.Len()));
+	}
+
+	// Parse JSON straight from the UTF-8 receive buffer
+	TSharedPtr<FJsonObject> Object;
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Message);
+	return FJsonSerializer::Deserialize(Reader, Object) ? Object : nullptr;
+}
+
+bool FGRIDConnection::SerializeMessage(FArchive& Archive, const TSharedPtr<FJsonObject>& Message) const
+{
+	if (Encoding == EGRIDEncoding::MessagePack)
+	{
+		return FGRIDMessagePack::Write(Archive, Message);
+	}
+
+	TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+		TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+	return FJsonSerializer::Serialize(Message.ToSharedRef(), Writer) && !Archive.IsError();
+}
+
+bool FGRIDConnection::TryGetFramedMessage(FUtf8StringView& OutMessage)
+{
+	const int32 Available = RecvBuffer.Num() - ReadOffset;
+	if (Available < FrameHeaderSize)
+	{
+		return false;
+	}
+
+	const uint8* Header = RecvBuffer.GetData() + ReadOffset;
+	const uint32 Length = (uint32(Header[0]) << 24) | (uint32(Header[1]) << 16) | (uint32(Header[2]) << 8) | uint32(Header[3]);
+	if (Length > static_cast<uint32>(MaxMessageSize))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GRID] Rejecting %u byte message (limit %d)"), Length, MaxMessageSize);
+		bProtocolError = true;
+		return false;
+	}
+
+	if (Available < FrameHeaderSize + static_cast<int32>(Length))
+	{
+		return false;
+	}
+
+	OutMessage = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Header + FrameHeaderSize), Length);
+	PendingMessageEnd = ReadOffset + FrameHeaderSize + Length;
+	return true;
+}
+
+bool FGRIDConnection::TryGetLegacyMessage(FUtf8StringView& OutMessage)
+{
+	// Legacy clients send one JSON object per request; find where it ends by tracking
+	// brace depth outside of string literals. The scan resumes where the last call stopped.
+	const uint8* Data = RecvBuffer.GetData();
+	for (; LegacyScanOffset < RecvBuffer.Num(); ++LegacyScanOffset)
+	{
+		const uint8 Char = Data[LegacyScanOffset];
+
+		if (LegacyDepth == 0)
+		{
+			if (IsJsonWhitespace(Char))
+			{
+				ReadOffset = LegacyScanOffset + 1;
+				continue;
+			}
+			if (Char != '{')
+			{
+				bProtocolError = true;
+				return false;
+			}
+		}
+
+		if (bLegacyInString)
+		{
+			if (bLegacyEscape)
+			{
+				bLegacyEscape = false;
+			}
+			else if (Char == '\\')
+			{
+				bLegacyEscape = true;
+			}
+			else if (Char == '"')
+			{
+				bLegacyInString = false;
+			}
+			continue;
+		}
+
+		if (Char == '"')
+		{
+			bLegacyInString = true;
+		}
+		else if (Char == '{')
+		{
+			LegacyDepth++;
+		}
+		else if (Char == '}' && --LegacyDepth == 0)
+		{
+			const int32 End = LegacyScanOffset + 1;
+			OutMessage = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data + ReadOffset), End - ReadOffset);
+			PendingMessageEnd = End;
+			LegacyScanOffset = End;
+			return true;
+		}
+	}
+
+	if (RecvBuffer.Num() - ReadOffset > MaxMessageSize)
+	{
+		bProtocolError = true;
+	}
+	return false;
+}
+
+bool FGRIDConnection::SendResponse(const TSharedPtr<FJsonObject>& Response)
+{
+	if (!Response.IsValid())
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&SendLock);
+
+	// Serialize straight to the wire encoding behind a reserved header, avoiding an FString round trip
+	const int32 HeaderSize = Framing == EGRIDFraming::LengthPrefixed ? FrameHeaderSize : 0;
+	SendBuffer.Reset();
+	SendBuffer.AddZeroed(HeaderSize);
+
+	// WriteBulk may already have placed a small response in SendBuffer
+	TSharedPtr<FJsonObject> Message = BulkRing.IsValid() ? WriteBulk(Response) : Response;
+	if (Message.IsValid())
+	{
+		FMemoryWriter Archive(SendBuffer, false, true);
+		if (!SerializeMessage(Archive, Message))
+		{
+			return false;
+		}
+	}
+
+	const int32 PayloadSize = SendBuffer.Num() - HeaderSize;
+	if (PayloadSize > MaxMessageSize)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GRID] Response of %d bytes exceeds message limit"), PayloadSize);
+		return false;
+	}
+
+	if (HeaderSize > 0)
+	{
+		SendBuffer[0] = static_cast<uint8>(PayloadSize >> 24);
+		SendBuffer[1] = static_cast<uint8>(PayloadSize >> 16);
+		SendBuffer[2] = static_cast<uint8>(PayloadSize >> 8);
+		SendBuffer[3] = static_cast<uint8>(PayloadSize);
+	}
+
+	return SendAll(SendBuffer.GetData(), SendBuffer.Num());
+}
+
+TSharedPtr<FJsonObject> FGRIDConnection::WriteBulk(const TSharedPtr<FJsonObject>& Response)
+{
+	int64 Offset = 0;
+	int64 Capacity = 0;
+	uint8* Span = BulkRing->BeginWrite(Offset, Capacity);
+	if (!Span)
+	{
+		// Ring full until the client releases something; the socket still works
+		return Response;
+	}
+
+	// Serialize in place, so a large response is copied once, into memory the client maps
+	FSpanWriter Writer(Span, Capacity);
+	if (!SerializeMessage(Writer, Response))
+	{
+		return Response;
+	}
+
+	const int64 Length = Writer.Tell();
+	if (Length < BulkThreshold)
+	{
+		// Small responses are cheaper over the socket; reuse the bytes already serialized
+		SendBuffer.Append(Span, static_cast<int32>(Length));
+		return nullptr;
+	}
+
+	BulkRing->CommitWrite(Offset, Length);
+
+	TSharedPtr<FJsonObject> Location = MakeShared<FJsonObject>();
+	Location->SetNumberField(TEXT("offset"), static_cast<double>(Offset));
+	Location->SetNumberField(TEXT("length"), static_cast<double>(Length));
+
+	TSharedPtr<FJsonObject> Message = MakeShared<FJsonObject>();
+	if (TSharedPtr<FJsonValue> Id = Response->TryGetField(TEXT("id")))
+	{
+		Message->SetField(TEXT("id"), Id);
+	}
+	Message->SetObjectField(TEXT("bulk"), Location);
+	return Message;
+}
+
+void FGRIDConnection::SetBulkRing(TUniquePtr<FGRIDSharedRing> InRing, int64 InThreshold)
+{
+	FScopeLock ScopeLock(&SendLock);
+	BulkRing = MoveTemp(InRing);
+	BulkThreshold = InThreshold;
+}
+
+bool FGRIDConnection::ReleaseBulk(int64 Offset, int64 Length)
+{
+	return BulkRing.IsValid() && BulkRing->Release(Offset, Length);
+}
+
+bool FGRIDConnection::SendAll(const uint8* Data, int32 Num)
+{
+	int32 Offset = 0;
+	while (Offset < Num)
+	{
+		int32 BytesSent = 0;
+		if (!Socket->Send(Data + Offset, Num - Offset, BytesSent))
+		{
+			// Non-blocking sockets refuse writes while the kernel buffer is full
+			if (ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() != SE_EWOULDBLOCK)
+			{
+				return false;
+			}
+			BytesSent = 0;
+		}
+
+		Offset += BytesSent;
+		if (Offset < Num && !Socket->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::FromSeconds(5)))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GRID] Timed out sending response (%d of %d bytes sent)"), Offset, Num);
+			return false;
+		}
+	}
+	return true;
+}
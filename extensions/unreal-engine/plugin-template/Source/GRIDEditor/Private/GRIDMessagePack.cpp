@@ -0,0 +1,381 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "GRIDMessagePack.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+	// Nesting deeper than this is rejected rather than risking the stack
+	constexpr int32 MaxDepth = 128;
+
+	class FMessagePackWriter
+	{
+	public:
+		explicit FMessagePackWriter(FArchive& InArchive)
+			: Archive(InArchive)
+		{
+		}
+
+		void WriteObject(const FJsonObject& Object)
+		{
+			WriteHeader(Object.Values.Num(), 0x80, 16, 0xde);
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object.Values)
+			{
+				WriteString(Pair.Key);
+				WriteValue(Pair.Value);
+			}
+		}
+
+	private:
+		void WriteValue(const TSharedPtr<FJsonValue>& Value)
+		{
+			if (!Value.IsValid())
+			{
+				WriteByte(0xc0);
+				return;
+			}
+
+			switch (Value->Type)
+			{
+			case EJson::Boolean:
+				WriteByte(Value->AsBool() ? 0xc3 : 0xc2);
+				break;
+			case EJson::Number:
+				WriteNumber(Value->AsNumber());
+				break;
+			case EJson::String:
+				WriteString(Value->AsString());
+				break;
+			case EJson::Array:
+			{
+				const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+				WriteHeader(Array.Num(), 0x90, 16, 0xdc);
+				for (const TSharedPtr<FJsonValue>& Element : Array)
+				{
+					WriteValue(Element);
+				}
+				break;
+			}
+			case EJson::Object:
+				WriteObject(*Value->AsObject());
+				break;
+			default:
+				WriteByte(0xc0);
+				break;
+			}
+		}
+
+		void WriteNumber(double Number)
+		{
+			// Doubles hold integers exactly up to 2^53; anything integral in that range packs smaller
+			const double Limit = 9007199254740992.0;
+			if (FMath::IsFinite(Number) && Number == FMath::FloorToDouble(Number) && FMath::Abs(Number) <= Limit)
+			{
+				const int64 Integer = static_cast<int64>(Number);
+				if (Integer >= 0)
+				{
+					if (Integer < 128)
+					{
+						WriteByte(static_cast<uint8>(Integer));
+					}
+					else if (Integer <= MAX_uint8)
+					{
+						WriteByte(0xcc);
+						WriteBigEndian(Integer, 1);
+					}
+					else if (Integer <= MAX_uint16)
+					{
+						WriteByte(0xcd);
+						WriteBigEndian(Integer, 2);
+					}
+					else if (Integer <= MAX_uint32)
+					{
+						WriteByte(0xce);
+						WriteBigEndian(Integer, 4);
+					}
+					else
+					{
+						WriteByte(0xcf);
+						WriteBigEndian(Integer, 8);
+					}
+				}
+				else if (Integer >= -32)
+				{
+					WriteByte(static_cast<uint8>(Integer));
+				}
+				else if (Integer >= MIN_int8)
+				{
+					WriteByte(0xd0);
+					WriteBigEndian(Integer, 1);
+				}
+				else if (Integer >= MIN_int16)
+				{
+					WriteByte(0xd1);
+					WriteBigEndian(Integer, 2);
+				}
+				else if (Integer >= MIN_int32)
+				{
+					WriteByte(0xd2);
+					WriteBigEndian(Integer, 4);
+				}
+				else
+				{
+					WriteByte(0xd3);
+					WriteBigEndian(Integer, 8);
+				}
+				return;
+			}
+
+			uint64 Bits = 0;
+			FMemory::Memcpy(&Bits, &Number, sizeof(Bits));
+			WriteByte(0xcb);
+			WriteBigEndian(static_cast<int64>(Bits), 8);
+		}
+
+		void WriteString(const FString& String)
+		{
+			const FTCHARToUTF8 Utf8(*String, String.Len());
+			const int32 Length = Utf8.Length();
+			if (Length < 32)
+			{
+				WriteByte(static_cast<uint8>(0xa0 | Length));
+			}
+			else if (Length <= MAX_uint8)
+			{
+				WriteByte(0xd9);
+				WriteBigEndian(Length, 1);
+			}
+			else if (Length <= MAX_uint16)
+			{
+				WriteByte(0xda);
+				WriteBigEndian(Length, 2);
+			}
+			else
+			{
+				WriteByte(0xdb);
+				WriteBigEndian(Length, 4);
+			}
+			Archive.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Length);
+		}
+
+		/** Fix-size header for small counts, otherwise a 16- or 32-bit count */
+		void WriteHeader(int32 Count, uint8 FixPrefix, int32 FixLimit, uint8 Prefix16)
+		{
+			if (Count < FixLimit)
+			{
+				WriteByte(static_cast<uint8>(FixPrefix | Count));
+			}
+			else if (Count <= MAX_uint16)
+			{
+				WriteByte(Prefix16);
+				WriteBigEndian(Count, 2);
+			}
+			else
+			{
+				WriteByte(Prefix16 + 1);
+				WriteBigEndian(Count, 4);
+			}
+		}
+
+		void WriteByte(uint8 Byte)
+		{
+			Archive.Serialize(&Byte, 1);
+		}
+
+		void WriteBigEndian(int64 Value, int32 NumBytes)
+		{
+			uint8 Bytes[8];
+			for (int32 Index = 0; Index < NumBytes; Index++)
+			{
+				Bytes[Index] = static_cast<uint8>(static_cast<uint64>(Value) >> (8 * (NumBytes - 1 - Index)));
+			}
+			Archive.Serialize(Bytes, NumBytes);
+		}
+
+		FArchive& Archive;
+	};
+
+	class FMessagePackReader
+	{
+	public:
+		explicit FMessagePackReader(TConstArrayView<uint8> InData)
+			: Data(InData)
+			, Offset(0)
+			, bError(false)
+		{
+		}
+
+		TSharedPtr<FJsonValue> ReadValue(int32 Depth)
+		{
+			if (Depth > MaxDepth)
+			{
+				return Fail();
+			}
+
+			const uint8 Byte = ReadByte();
+			if (bError)
+			{
+				return nullptr;
+			}
+
+			if (Byte <= 0x7f)
+			{
+				return MakeShared<FJsonValueNumber>(Byte);
+			}
+			if (Byte >= 0xe0)
+			{
+				return MakeShared<FJsonValueNumber>(static_cast<int8>(Byte));
+			}
+			if ((Byte & 0xf0) == 0x80)
+			{
+				return ReadMap(Byte & 0x0f, Depth);
+			}
+			if ((Byte & 0xf0) == 0x90)
+			{
+				return ReadArray(Byte & 0x0f, Depth);
+			}
+			if ((Byte & 0xe0) == 0xa0)
+			{
+				return ReadString(Byte & 0x1f);
+			}
+
+			switch (Byte)
+			{
+			case 0xc0: return MakeShared<FJsonValueNull>();
+			case 0xc2: return MakeShared<FJsonValueBoolean>(false);
+			case 0xc3: return MakeShared<FJsonValueBoolean>(true);
+			case 0xc4: case 0xd9: return ReadString(ReadBigEndian(1));
+			case 0xc5: case 0xda: return ReadString(ReadBigEndian(2));
+			case 0xc6: case 0xdb: return ReadString(ReadBigEndian(4));
+			case 0xca:
+			{
+				const uint32 Bits = static_cast<uint32>(ReadBigEndian(4));
+				float Value;
+				FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+				return MakeShared<FJsonValueNumber>(Value);
+			}
+			case 0xcb:
+			{
+				const uint64 Bits = ReadBigEndian(8);
+				double Value;
+				FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+				return MakeShared<FJsonValueNumber>(Value);
+			}
+			case 0xcc: return MakeShared<FJsonValueNumber>(static_cast<double>(ReadBigEndian(1)));
+			case 0xcd: return MakeShared<FJsonValueNumber>(static_cast<double>(ReadBigEndian(2)));
+			case 0xce: return MakeShared<FJsonValueNumber>(static_cast<double>(ReadBigEndian(4)));
+			case 0xcf: return MakeShared<FJsonValueNumber>(static_cast<double>(ReadBigEndian(8)));
+			case 0xd0: return MakeShared<FJsonValueNumber>(static_cast<int8>(ReadBigEndian(1)));
+			case 0xd1: return MakeShared<FJsonValueNumber>(static_cast<int16>(ReadBigEndian(2)));
+			case 0xd2: return MakeShared<FJsonValueNumber>(static_cast<int32>(ReadBigEndian(4)));
+			case 0xd3: return MakeShared<FJsonValueNumber>(static_cast<double>(static_cast<int64>(ReadBigEndian(8))));
+			case 0xdc: return ReadArray(static_cast<int64>(ReadBigEndian(2)), Depth);
+			case 0xdd: return ReadArray(static_cast<int64>(ReadBigEndian(4)), Depth);
+			case 0xde: return ReadMap(static_cast<int64>(ReadBigEndian(2)), Depth);
+			case 0xdf: return ReadMap(static_cast<int64>(ReadBigEndian(4)), Depth);
+			default: return Fail();
+			}
+		}
+
+		bool IsAtEnd() const { return !bError && Offset == Data.Num(); }
+
+	private:
+		TSharedPtr<FJsonValue> ReadMap(int64 Count, int32 Depth)
+		{
+			TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+			for (int64 Index = 0; Index < Count && !bError; Index++)
+			{
+				TSharedPtr<FJsonValue> Key = ReadValue(Depth + 1);
+				TSharedPtr<FJsonValue> Value = ReadValue(Depth + 1);
+				if (bError || Key->Type != EJson::String)
+				{
+					return Fail();
+				}
+				Object->SetField(Key->AsString(), Value);
+			}
+			return bError ? nullptr : MakeShared<FJsonValueObject>(Object);
+		}
+
+		TSharedPtr<FJsonValue> ReadArray(int64 Count, int32 Depth)
+		{
+			// Every element takes at least one byte, which bounds a hostile count
+			if (Count > Data.Num() - Offset)
+			{
+				return Fail();
+			}
+
+			TArray<TSharedPtr<FJsonValue>> Array;
+			Array.Reserve(static_cast<int32>(Count));
+			for (int64 Index = 0; Index < Count && !bError; Index++)
+			{
+				Array.Add(ReadValue(Depth + 1));
+			}
+			return bError ? nullptr : MakeShared<FJsonValueArray>(Array);
+		}
+
+		TSharedPtr<FJsonValue> ReadString(uint64 Length)
+		{
+			if (bError || Length > static_cast<uint64>(Data.Num() - Offset))
+			{
+				return Fail();
+			}
+
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Offset), static_cast<int32>(Length));
+			Offset += static_cast<int32>(Length);
+			return MakeShared<FJsonValueString>(FString(Converted.Length(), Converted.Get()));
+		}
+
+		uint8 ReadByte()
+		{
+			if (Offset >= Data.Num())
+			{
+				bError = true;
+				return 0;
+			}
+			return Data[Offset++];
+		}
+
+		uint64 ReadBigEndian(int32 NumBytes)
+		{
+			uint64 Value = 0;
+			for (int32 Index = 0; Index < NumBytes; Index++)
+			{
+				Value = (Value << 8) | ReadByte();
+			}
+			return Value;
+		}
+
+		TSharedPtr<FJsonValue> Fail()
+		{
+			bError = true;
+			return nullptr;
+		}
+
+		TConstArrayView<uint8> Data;
+		int32 Offset;
+		bool bError;
+	};
+}
+
+bool FGRIDMessagePack::Write(FArchive& Archive, const TSharedPtr<FJsonObject>& Object)
+{
+	if (!Object.IsValid())
+	{
+		return false;
+	}
+
+	FMessagePackWriter Writer(Archive);
+	Writer.WriteObject(*Object);
+	return !Archive.IsError();
+}
+
+TSharedPtr<FJsonObject> FGRIDMessagePack::Read(TConstArrayView<uint8> Data)
+{
+	FMessagePackReader Reader(Data);
+	TSharedPtr<FJsonValue> Value = Reader.ReadValue(0);
+	if (!Value.IsValid() || !Reader.IsAtEnd() || Value->Type != EJson::Object)
+	{
+		return nullptr;
+	}
+	return Value->AsObject();
+}
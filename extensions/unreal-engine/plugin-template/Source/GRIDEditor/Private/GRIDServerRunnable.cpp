@@ -2,15 +2,22 @@
 
 #include "GRIDServerRunnable.h"
 #include "GRIDBridge.h"
+#include "GRIDConnection.h"
+#include "GRIDSocketPoller.h"
+#include "GRIDSharedRing.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/QueuedThreadPool.h"
 #include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonReader.h"
 
-FGRIDServerRunnable::FGRIDServerRunnable(FGRIDBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
+FGRIDServerRunnable::FGRIDServerRunnable(FGRIDBridge* InBridge, TArray<TSharedPtr<FSocket>> InListenerSockets)
 	: Bridge(InBridge)
-	, ListenerSocket(InListenerSocket)
+	, ListenerSockets(MoveTemp(InListenerSockets))
+	, Handle(MakeShared<FServerHandle>())
+	, ConnectionPool(nullptr)
+	, NextConnectionKey(ListenerSockets.Num())
 {
 }
 
@@ -20,104 +27,713 @@ FGRIDServerRunnable::~FGRIDServerRunnable()
 
 bool FGRIDServerRunnable::Init()
 {
+	Poller = MakeUnique<FGRIDSocketPoller>();
+	if (!Poller->Init() || ListenerSockets.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to initialize socket poller"));
+		return false;
+	}
+
+	for (int32 Index = 0; Index < ListenerSockets.Num(); Index++)
+	{
+		if (!ListenerSockets[Index].IsValid() || !Poller->Add(ListenerSockets[Index].Get(), Index))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to watch listener socket"));
+			return false;
+		}
+	}
+
+	const int32 MaxConnections = Bridge ? Bridge->GetSettings().MaxConnections : 1;
+
+	ConnectionPool = FQueuedThreadPool::Allocate();
+	if (!ConnectionPool->Create(MaxConnections, 128 * 1024, TPri_Normal, TEXT("GRIDConnectionPool")))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to create connection pool"));
+		delete ConnectionPool;
+		ConnectionPool = nullptr;
+		return false;
+	}
+
+	Handle->Server = this;
 	return true;
 }
 
 uint32 FGRIDServerRunnable::Run()
 {
+	TArray<uint64> ReadyKeys;
+
 	while (StopTaskCounter.GetValue() == 0)
 	{
-		if (!ListenerSocket.IsValid())
+		// Sleep until a socket is readable, a response is sent, Stop() is called or a timeout is due
+		const double WaitSeconds = ServiceTimeouts();
+		ReadyKeys.Reset();
+		Poller->Wait(ReadyKeys, WaitSeconds);
+
+		TPair<uint64, TSharedPtr<FGRIDRequest>> Completed;
+		while (CompletedRequests.Dequeue(Completed))
 		{
-			break;
+			CompleteRequest(Completed.Key, Completed.Value);
 		}
 
-		bool bHasPendingConnection = false;
-		if (ListenerSocket->WaitForPendingConnection(bHasPendingConnection, FTimespan::FromMilliseconds(100)))
+		for (const uint64 Key : ReadyKeys)
 		{
-			if (bHasPendingConnection)
+			if (Key < static_cast<uint64>(ListenerSockets.Num()))
 			{
-				TSharedPtr<FInternetAddr> ClientAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-				FSocket* ClientSocket = ListenerSocket->Accept(*ClientAddr, TEXT("GRID Client"));
-
-				if (ClientSocket)
-				{
-					HandleClientConnection(ClientSocket);
-					ClientSocket->Close();
-					ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ClientSocket);
-				}
+				AcceptConnections(ListenerSockets[Key].Get());
+			}
+			else if (const TSharedPtr<FGRIDConnection>* Connection = Connections.Find(Key))
+			{
+				ReadConnection(*Connection);
 			}
 		}
 	}
 
+	// Commands still running on the game thread drop their responses from here on
+	{
+		FScopeLock ScopeLock(&Handle->Lock);
+		Handle->Server = nullptr;
+	}
+
+	// Workers still reference their connections' sockets
+	while (ActiveSends.GetValue() > 0)
+	{
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	TArray<uint64> OpenKeys;
+	Connections.GetKeys(OpenKeys);
+	for (const uint64 Key : OpenKeys)
+	{
+		CloseConnection(Key);
+	}
+
+	for (const TSharedPtr<FSocket>& Listener : ListenerSockets)
+	{
+		Poller->Remove(Listener.Get());
+	}
+
 	return 0;
 }
 
 void FGRIDServerRunnable::Stop()
 {
 	StopTaskCounter.Increment();
+	if (Poller.IsValid())
+	{
+		Poller->Wakeup();
+	}
 }
 
 void FGRIDServerRunnable::Exit()
 {
+	if (ConnectionPool)
+	{
+		ConnectionPool->Destroy();
+		delete ConnectionPool;
+		ConnectionPool = nullptr;
+	}
+}
+
+void FGRIDServerRunnable::AcceptConnections(FSocket* Listener)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	const int32 MaxConnections = Bridge->GetSettings().MaxConnections;
+
+	// The listener is non-blocking, so Accept returns null once the backlog is drained
+	while (FSocket* ClientSocket = Listener->Accept(TEXT("GRID Client")))
+	{
+		if (Connections.Num() >= MaxConnections)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[GRID] Refusing client connection: %d connections already open"), MaxConnections);
+
+			// The refused client has not negotiated framing yet, so reply with bare JSON
+			ClientSocket->SetNonBlocking(false);
+			FGRIDConnection Refused(ClientSocket);
+			Refused.SendResponse(FGRIDBridge::CreateErrorResponse(TEXT("BUSY"),
+				FString::Printf(TEXT("Server is at its limit of %d connections"), MaxConnections)));
+			ClientSocket->Close();
+			SocketSubsystem->DestroySocket(ClientSocket);
+			continue;
+		}
+
+		ClientSocket->SetNonBlocking(true);
+		ClientSocket->SetNoDelay(true); // No-op on Unix domain sockets
+
+		TSharedPtr<FGRIDConnection> Connection = MakeShared<FGRIDConnection>(ClientSocket);
+		Connection->Key = NextConnectionKey++;
+		Connection->LastActivityTime = FPlatformTime::Seconds();
+
+		if (!Poller->Add(ClientSocket, Connection->Key))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to watch client socket"));
+			ClientSocket->Close();
+			SocketSubsystem->DestroySocket(ClientSocket);
+			continue;
+		}
+
+		Connections.Add(Connection->Key, Connection);
+		Bridge->GetStats().RecordConnectionOpened();
+	}
+}
+
+void FGRIDServerRunnable::ReadConnection(const TSharedPtr<FGRIDConnection>& Connection)
+{
+	if (!Connection->ReceiveAvailable())
+	{
+		// Stop watching so a closed socket doesn't keep waking the loop; close once idle
+		Connection->bPeerClosed = true;
+		Poller->Remove(Connection->GetSocket());
+		if (Connection->InFlight.Num() == 0)
+		{
+			CloseConnection(Connection->Key);
+		}
+		return;
+	}
+
+	Connection->LastActivityTime = FPlatformTime::Seconds();
+	PumpConnection(Connection);
+}
+
+void FGRIDServerRunnable::PumpConnection(const TSharedPtr<FGRIDConnection>& Connection)
+{
+	while (!Connection->bPeerClosed && !Connection->bSendFailed)
+	{
+		// An exclusive request runs alone; nothing else starts until its response is out
+		if (Connection->InFlight.ContainsByPredicate([](const TSharedPtr<FGRIDRequest>& Request) { return Request->bExclusive; }))
+		{
+			return;
+		}
+
+		if (Connection->DeferredRequest.IsValid())
+		{
+			if (Connection->InFlight.Num() > 0)
+			{
+				return;
+			}
+			TSharedPtr<FGRIDRequest> Deferred = MoveTemp(Connection->DeferredRequest);
+			Connection->DeferredRequest.Reset();
+			DispatchRequest(Connection, Deferred);
+			continue;
+		}
+
+		// A single read may carry several requests, or only part of one
+		FUtf8StringView RequestData;
+		if (!Connection->TryGetMessage(RequestData))
+		{
+			if (Connection->HasProtocolError() && Connection->InFlight.Num() == 0)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[GRID] Closing client connection after malformed message"));
+				CloseConnection(Connection->Key);
+			}
+			return;
+		}
+
+		TSharedPtr<FGRIDRequest> Request = ParseRequest(*Connection, RequestData);
+		Connection->ConsumeMessage();
+		Connection->RequestsServed++;
+
+		if (Request->bExclusive && Connection->InFlight.Num() > 0)
+		{
+			Connection->DeferredRequest = Request;
+			return;
+		}
+
+		DispatchRequest(Connection, Request);
+	}
 }
 
-void FGRIDServerRunnable::HandleClientConnection(FSocket* ClientSocket)
+void FGRIDServerRunnable::DispatchRequest(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request)
 {
-	if (!ClientSocket || !Bridge)
+	if (Request->TimeoutSeconds > 0.0)
+	{
+		Request->Cancellation->SetDeadline(FPlatformTime::Seconds() + Request->TimeoutSeconds);
+	}
+	Connection->InFlight.Add(Request);
+
+	if (Request->ParseError.IsValid())
 	{
+		Reply(Connection, Request, Request->ParseError);
 		return;
 	}
 
-	// Read request data
-	TArray<uint8> Buffer;
-	Buffer.SetNumUninitialized(65536);
-	int32 BytesRead = 0;
+	if (Request->CommandType == TEXT("bulk_release"))
+	{
+		Reply(Connection, Request, ReleaseBulk(*Connection, *Request));
+		return;
+	}
 
-	ClientSocket->SetNonBlocking(false);
-	ClientSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(5));
+	// Answered here so liveness probes never wait for a busy game thread
+	if (Request->CommandType == TEXT("heartbeat"))
+	{
+		Reply(Connection, Request, Bridge->Heartbeat());
+		return;
+	}
 
-	if (ClientSocket->Recv(Buffer.GetData(), Buffer.Num(), BytesRead))
+	if (Request->CommandType == TEXT("cancel"))
 	{
-		if (BytesRead > 0)
+		Reply(Connection, Request, CancelRequest(Connection, *Request));
+		return;
+	}
+
+	// Control requests above are always answered; commands are refused once the connection has too many in flight
+	const int32 MaxInFlight = Bridge->GetSettings().MaxInFlightPerConnection;
+	if (Connection->InFlight.Num() > MaxInFlight)
+	{
+		Bridge->GetStats().RecordRejected(false);
+		Reply(Connection, Request, Bridge->CreateBusyResponse(
+			FString::Printf(TEXT("Connection has %d requests in flight; retry later"), MaxInFlight), Connection->InFlight.Num()));
+		return;
+	}
+
+	// Only queueing happens here; the job outlives the request and its deadline
+	if (Request->bJob)
+	{
+		Reply(Connection, Request, Bridge->StartJob(Request->CommandType, Request->Params, Request->Priority));
+		return;
+	}
+
+	TWeakPtr<FGRIDConnection> WeakConnection = Connection;
+	Bridge->ExecuteCommandAsync(Request->CommandType, Request->Params, Request->Cancellation, Request->Priority,
+		[ServerHandle = Handle, WeakConnection, Request](const TSharedPtr<FJsonObject>& Response)
 		{
-			FString RequestData = FString(UTF8_TO_TCHAR(reinterpret_cast<const char*>(Buffer.GetData())));
-			RequestData = RequestData.Left(BytesRead);
+			FScopeLock ScopeLock(&ServerHandle->Lock);
+			TSharedPtr<FGRIDConnection> Connection = WeakConnection.Pin();
+			if (ServerHandle->Server && Connection.IsValid())
+			{
+				ServerHandle->Server->Reply(Connection, Request, Response);
+			}
+		},
+		[ServerHandle = Handle, WeakConnection, Request](const TSharedPtr<FJsonObject>& Chunk)
+		{
+			FScopeLock ScopeLock(&ServerHandle->Lock);
+			TSharedPtr<FGRIDConnection> Connection = WeakConnection.Pin();
+			return ServerHandle->Server && Connection.IsValid() && ServerHandle->Server->SendChunk(Connection, Request, Chunk);
+		});
+}
 
-			FString ResponseData = ProcessRequest(RequestData);
+void FGRIDServerRunnable::Reply(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, TSharedPtr<FJsonObject> Response)
+{
+	// Either the command or the timeout answers, never both
+	if (!Request->TryClaimReply())
+	{
+		return;
+	}
+
+	if (!Response.IsValid())
+	{
+		Response = FGRIDBridge::CreateErrorResponse(TEXT("INTERNAL_ERROR"), TEXT("Command produced no response"));
+	}
+	if (Request->Id.IsValid())
+	{
+		Response->SetField(TEXT("id"), Request->Id);
+	}
+
+	Post(Connection, Request, { Response, true });
+}
+
+bool FGRIDServerRunnable::SendChunk(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, const TSharedPtr<FJsonObject>& Chunk)
+{
+	// Nothing more is sent once the request has been answered, e.g. by a timeout
+	if (Request->IsReplied() || !Chunk.IsValid() || Connection->bSendFailed)
+	{
+		return false;
+	}
+
+	if (Request->Id.IsValid())
+	{
+		Chunk->SetField(TEXT("id"), Request->Id);
+	}
+	Chunk->SetBoolField(TEXT("partial"), true);
 
-			// Send response
-			FTCHARToUTF8 Converter(*ResponseData);
-			int32 BytesSent = 0;
-			ClientSocket->Send(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length(), BytesSent);
+	// Each chunk proves the command is making progress, so the timeout restarts
+	if (Request->TimeoutSeconds > 0.0)
+	{
+		Request->Cancellation->SetDeadline(FPlatformTime::Seconds() + Request->TimeoutSeconds);
+	}
+	Post(Connection, Request, { Chunk, false });
+	return true;
+}
+
+void FGRIDServerRunnable::Post(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, FGRIDOutbound&& Outbound)
+{
+	Request->Outbox.Enqueue(MoveTemp(Outbound));
+
+	// One worker at a time drains a request's outbox, which keeps its messages in order
+	if (Request->bDraining.exchange(true))
+	{
+		return;
+	}
+
+	// Serialization and the socket write stay off the game and server threads
+	ActiveSends.Increment();
+	AsyncPool(*ConnectionPool, [this, Connection, Request]()
+	{
+		for (;;)
+		{
+			FGRIDOutbound Next;
+			while (Request->Outbox.Dequeue(Next))
+			{
+				// Anything posted after the final response was raced by a timeout; drop it
+				if (!Request->bFinished)
+				{
+					SendOutbound(Connection, Request, Next);
+				}
+			}
+
+			// A message posted after the queue looked empty but before the flag cleared is picked up here
+			Request->bDraining = false;
+			if (Request->Outbox.IsEmpty() || Request->bDraining.exchange(true))
+			{
+				break;
+			}
+		}
+		ActiveSends.Decrement();
+	});
+}
+
+void FGRIDServerRunnable::SendOutbound(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, const FGRIDOutbound& Outbound)
+{
+	if (!Outbound.bFinal)
+	{
+		if (!Connection->bSendFailed && !Connection->SendResponse(Outbound.Message))
+		{
+			Connection->bSendFailed = true;
 		}
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>& Response = Outbound.Message;
+	const bool bSwitchToFraming = NegotiateFraming(*Connection, *Request, Response);
+	const bool bSwitchToMessagePack = NegotiateEncoding(*Connection, *Request, Response,
+		bSwitchToFraming || Connection->GetFraming() == EGRIDFraming::LengthPrefixed);
+	TUniquePtr<FGRIDSharedRing> BulkRing = OfferBulkRing(*Connection, *Request, Response);
+
+	if (!Connection->bSendFailed && !Connection->SendResponse(Response))
+	{
+		Connection->bSendFailed = true;
+	}
+	if (bSwitchToFraming)
+	{
+		Connection->SetFraming(EGRIDFraming::LengthPrefixed);
+	}
+	if (bSwitchToMessagePack)
+	{
+		Connection->SetEncoding(EGRIDEncoding::MessagePack);
+	}
+	if (BulkRing.IsValid())
+	{
+		Connection->SetBulkRing(MoveTemp(BulkRing), static_cast<int64>(Bridge->GetSettings().SharedMemoryThresholdKB) * 1024);
+	}
+
+	Request->bFinished = true;
+	CompletedRequests.Enqueue(TPair<uint64, TSharedPtr<FGRIDRequest>>(Connection->Key, Request));
+	Poller->Wakeup();
+}
+
+void FGRIDServerRunnable::CompleteRequest(uint64 Key, const TSharedPtr<FGRIDRequest>& Request)
+{
+	const TSharedPtr<FGRIDConnection>* Found = Connections.Find(Key);
+	if (!Found)
+	{
+		return;
+	}
+
+	TSharedPtr<FGRIDConnection> Connection = *Found;
+	Connection->InFlight.Remove(Request);
+	Connection->LastActivityTime = FPlatformTime::Seconds();
+
+	if (Connection->bPeerClosed || Connection->bSendFailed || Connection->HasProtocolError())
+	{
+		if (Connection->InFlight.Num() == 0)
+		{
+			CloseConnection(Key);
+		}
+		return;
+	}
+
+	// Requests that arrived while this one ran are already buffered
+	PumpConnection(Connection);
+}
+
+void FGRIDServerRunnable::CloseConnection(uint64 Key)
+{
+	TSharedPtr<FGRIDConnection> Connection;
+	if (!Connections.RemoveAndCopyValue(Key, Connection))
+	{
+		return;
+	}
+
+	FSocket* Socket = Connection->GetSocket();
+	if (!Connection->bPeerClosed)
+	{
+		Poller->Remove(Socket);
 	}
+	Socket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+
+	Bridge->GetStats().RecordConnectionClosed(Connection->RequestsServed);
 }
 
-FString FGRIDServerRunnable::ProcessRequest(const FString& RequestData)
+double FGRIDServerRunnable::ServiceTimeouts()
 {
-	// Parse JSON request
-	TSharedPtr<FJsonObject> RequestJson;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(RequestData);
+	const FGRIDBridgeSettings& Settings = Bridge->GetSettings();
+	const double IdleTimeout = Settings.ConnectionIdleTimeoutSeconds;
+
+	const double Now = FPlatformTime::Seconds();
+	double NextDeadline = -1.0;
+	TArray<uint64> Expired;
 
-	if (!FJsonSerializer::Deserialize(Reader, RequestJson) || !RequestJson.IsValid())
+	auto ConsiderDeadline = [&NextDeadline](double Remaining)
 	{
-		return TEXT("{\"success\":false,\"error_code\":\"INVALID_JSON\",\"error\":\"Failed to parse request JSON\"}");
+		if (NextDeadline < 0.0 || Remaining < NextDeadline)
+		{
+			NextDeadline = Remaining;
+		}
+	};
+
+	for (const TPair<uint64, TSharedPtr<FGRIDConnection>>& Pair : Connections)
+	{
+		const TSharedPtr<FGRIDConnection>& Connection = Pair.Value;
+		if (Connection->InFlight.Num() > 0)
+		{
+			for (const TSharedPtr<FGRIDRequest>& Request : Connection->InFlight)
+			{
+				const double Deadline = Request->Cancellation->GetDeadline();
+				if (Request->IsReplied() || Deadline <= 0.0)
+				{
+					continue;
+				}
+
+				const double Remaining = Deadline - Now;
+				if (Remaining <= 0.0)
+				{
+					// The command is dropped if still queued; a running handler may notice and stop early
+					UE_LOG(LogTemp, Warning, TEXT("[GRID] Command timed out: %s"), *Request->CommandType);
+					Request->Cancellation->Cancel();
+					Reply(Connection, Request, FGRIDBridge::CreateErrorResponse(TEXT("TIMEOUT"), TEXT("Command execution timed out")));
+				}
+				else
+				{
+					ConsiderDeadline(Remaining);
+				}
+			}
+			continue;
+		}
+
+		if (IdleTimeout <= 0.0)
+		{
+			continue;
+		}
+
+		const double Remaining = Connection->LastActivityTime + IdleTimeout - Now;
+		if (Remaining <= 0.0)
+		{
+			Expired.Add(Pair.Key);
+		}
+		else
+		{
+			ConsiderDeadline(Remaining);
+		}
 	}
 
+	for (const uint64 Key : Expired)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[GRID] Closing idle client connection after %d requests"), Connections[Key]->RequestsServed);
+		CloseConnection(Key);
+	}
+
+	return NextDeadline;
+}
+
+TSharedPtr<FGRIDRequest> FGRIDServerRunnable::ParseRequest(const FGRIDConnection& Connection, FUtf8StringView RequestData) const
+{
+	TSharedPtr<FGRIDRequest> Request = MakeShared<FGRIDRequest>();
+
+	TSharedPtr<FJsonObject> RequestJson = Connection.DecodeMessage(RequestData);
+	if (!RequestJson.IsValid())
+	{
+		Request->ParseError = Connection.GetEncoding() == EGRIDEncoding::MessagePack
+			? FGRIDBridge::CreateErrorResponse(TEXT("INVALID_MESSAGE"), TEXT("Failed to decode MessagePack request"))
+			: FGRIDBridge::CreateErrorResponse(TEXT("INVALID_JSON"), TEXT("Failed to parse request JSON"));
+		Request->bExclusive = true;
+		return Request;
+	}
+
+	Request->Id = RequestJson->TryGetField(TEXT("id"));
+
 	// Extract command and params
-	FString CommandType;
-	if (!RequestJson->TryGetStringField(TEXT("command"), CommandType))
+	if (!RequestJson->TryGetStringField(TEXT("command"), Request->CommandType))
+	{
+		Request->ParseError = FGRIDBridge::CreateErrorResponse(TEXT("MISSING_COMMAND"), TEXT("Request missing 'command' field"));
+		Request->bExclusive = !Request->Id.IsValid();
+		return Request;
+	}
+
+	const TSharedPtr<FJsonObject>* ParamsField = nullptr;
+	Request->Params = RequestJson->TryGetObjectField(TEXT("params"), ParamsField) ? *ParamsField : MakeShared<FJsonObject>();
+
+	// A client deadline shorter than the server's keeps commands from running for a caller that gave up
+	const double ServerTimeout = Bridge->GetSettings().RequestTimeoutSeconds;
+	double ClientTimeoutMs = 0.0;
+	if (RequestJson->TryGetNumberField(TEXT("timeout_ms"), ClientTimeoutMs) && ClientTimeoutMs > 0.0)
+	{
+		const double ClientTimeout = ClientTimeoutMs / 1000.0;
+		Request->TimeoutSeconds = ServerTimeout > 0.0 ? FMath::Min(ClientTimeout, ServerTimeout) : ClientTimeout;
+	}
+	else
+	{
+		Request->TimeoutSeconds = FMath::Max(0.0, ServerTimeout);
+	}
+
+	RequestJson->TryGetBoolField(TEXT("job"), Request->bJob);
+
+	FString PriorityName;
+	EGRIDCommandPriority Priority;
+	if (RequestJson->TryGetStringField(TEXT("priority"), PriorityName) && LexTryParseString(Priority, *PriorityName))
+	{
+		Request->Priority = Priority;
+	}
+
+	// Untagged requests keep the one-at-a-time ordering older clients rely on, and nothing
+	// may be in flight while the framing, encoding or bulk channel changes underneath it
+	Request->bExclusive = !Request->Id.IsValid()
+		|| (Request->CommandType == TEXT("check_connection")
+			&& (Request->Params->HasField(TEXT("framing"))
+				|| Request->Params->HasField(TEXT("encoding"))
+				|| Request->Params->HasField(TEXT("shared_memory"))));
+	return Request;
+}
+
+bool FGRIDServerRunnable::NegotiateFraming(const FGRIDConnection& Connection, const FGRIDRequest& Request, const TSharedPtr<FJsonObject>& Response) const
+{
+	// Clients opt into length-prefixed framing during check_connection. The reply still uses
+	// the old framing; every message after it is framed.
+	FString RequestedFraming;
+	if (Request.CommandType != TEXT("check_connection")
+		|| Connection.GetFraming() != EGRIDFraming::Legacy
+		|| !Request.Params.IsValid()
+		|| !Request.Params->TryGetStringField(TEXT("framing"), RequestedFraming)
+		|| RequestedFraming != TEXT("length_prefixed"))
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Data = nullptr;
+	if (!Response->TryGetObjectField(TEXT("data"), Data))
+	{
+		return false;
+	}
+
+	(*Data)->SetStringField(TEXT("framing"), RequestedFraming);
+	return true;
+}
+
+bool FGRIDServerRunnable::NegotiateEncoding(const FGRIDConnection& Connection, const FGRIDRequest& Request, const TSharedPtr<FJsonObject>& Response, bool bFramed) const
+{
+	// Binary payloads cannot be delimited without a length prefix, so MessagePack is only
+	// agreed together with (or after) length-prefixed framing. Like framing, it applies after the reply.
+	FString RequestedEncoding;
+	if (!bFramed
+		|| Request.CommandType != TEXT("check_connection")
+		|| Connection.GetEncoding() != EGRIDEncoding::Json
+		|| !Request.Params.IsValid()
+		|| !Request.Params->TryGetStringField(TEXT("encoding"), RequestedEncoding)
+		|| RequestedEncoding != TEXT("msgpack"))
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Data = nullptr;
+	if (!Response->TryGetObjectField(TEXT("data"), Data))
+	{
+		return false;
+	}
+
+	(*Data)->SetStringField(TEXT("encoding"), RequestedEncoding);
+	return true;
+}
+
+TUniquePtr<FGRIDSharedRing> FGRIDServerRunnable::OfferBulkRing(const FGRIDConnection& Connection, const FGRIDRequest& Request, const TSharedPtr<FJsonObject>& Response) const
+{
+	// Clients on the same machine ask for a ring during check_connection. It takes effect after
+	// the reply, which tells the client what to map.
+	bool bRequested = false;
+	const int32 RingMB = Bridge->GetSettings().SharedMemoryRingMB;
+	if (Request.CommandType != TEXT("check_connection")
+		|| RingMB <= 0
+		|| Connection.HasBulkRing()
+		|| !Request.Params.IsValid()
+		|| !Request.Params->TryGetBoolField(TEXT("shared_memory"), bRequested)
+		|| !bRequested)
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<FJsonObject>* Data = nullptr;
+	if (!Response->TryGetObjectField(TEXT("data"), Data))
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FGRIDSharedRing> Ring = MakeUnique<FGRIDSharedRing>();
+	// Random rather than derived from the pid, so other local users can't claim the name first.
+	// Kept within the 31 characters Mac allows for shared memory names.
+	const FGuid Nonce = FGuid::NewGuid();
+	const FString Name = FString::Printf(TEXT("GRID-%08x%08x"), Nonce.A, Nonce.B);
+	if (!Ring->Create(Name, static_cast<int64>(RingMB) * 1024 * 1024))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> Description = MakeShared<FJsonObject>();
+	Description->SetStringField(TEXT("name"), Ring->GetName());
+	Description->SetNumberField(TEXT("size"), static_cast<double>(Ring->GetSize()));
+	(*Data)->SetObjectField(TEXT("shared_memory"), Description);
+	return Ring;
+}
+
+TSharedPtr<FJsonObject> FGRIDServerRunnable::CancelRequest(const TSharedPtr<FGRIDConnection>& Connection, const FGRIDRequest& Request)
+{
+	const TSharedPtr<FJsonValue> TargetId = Request.Params->TryGetField(TEXT("request_id"));
+	if (!TargetId.IsValid())
+	{
+		return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("cancel requires 'request_id'"));
+	}
+
+	// Only this connection's requests can be cancelled
+	const TSharedPtr<FGRIDRequest>* Target = Connection->InFlight.FindByPredicate([&TargetId](const TSharedPtr<FGRIDRequest>& InFlight)
+	{
+		return InFlight->Id.IsValid() && FJsonValue::CompareEqual(*InFlight->Id, *TargetId);
+	});
+	if (!Target)
+	{
+		return FGRIDBridge::CreateErrorResponse(TEXT("NOT_FOUND"), TEXT("No request in flight with that id"));
+	}
+
+	// Copied because the reply below may complete the target and remove it from InFlight
+	const TSharedPtr<FGRIDRequest> TargetRequest = *Target;
+	TargetRequest->Cancellation->Cancel();
+	const bool bCancelled = !TargetRequest->IsReplied();
+	Reply(Connection, TargetRequest, FGRIDBridge::CreateErrorResponse(TEXT("CANCELLED"), TEXT("Request was cancelled by the client")));
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetBoolField(TEXT("cancelled"), bCancelled);
+	return FGRIDBridge::CreateSuccessResponse(Data);
+}
+
+TSharedPtr<FJsonObject> FGRIDServerRunnable::ReleaseBulk(FGRIDConnection& Connection, const FGRIDRequest& Request) const
+{
+	double Offset = 0.0;
+	double Length = 0.0;
+	if (!Request.Params->TryGetNumberField(TEXT("offset"), Offset) || !Request.Params->TryGetNumberField(TEXT("length"), Length))
 	{
-		return TEXT("{\"success\":false,\"error_code\":\"MISSING_COMMAND\",\"error\":\"Request missing 'command' field\"}");
+		return FGRIDBridge::CreateErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("bulk_release requires 'offset' and 'length'"));
 	}
 
-	TSharedPtr<FJsonObject> Params = RequestJson->GetObjectField(TEXT("params"));
-	if (!Params.IsValid())
+	if (!Connection.ReleaseBulk(static_cast<int64>(Offset), static_cast<int64>(Length)))
 	{
-		Params = MakeShared<FJsonObject>();
+		return FGRIDBridge::CreateErrorResponse(TEXT("NOT_FOUND"), TEXT("No outstanding bulk response at that offset"));
 	}
 
-	// Execute command
-	return Bridge->ExecuteCommand(CommandType, Params);
+	return FGRIDBridge::CreateSuccessResponse(MakeShared<FJsonObject>());
 }
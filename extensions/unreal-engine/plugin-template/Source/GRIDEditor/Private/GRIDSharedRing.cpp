@@ -0,0 +1,142 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "GRIDSharedRing.h"
+#include "Misc/ScopeLock.h"
+
+#if PLATFORM_LINUX || PLATFORM_MAC
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FGRIDSharedRing::FGRIDSharedRing()
+	: Size(0)
+	, Region(nullptr)
+	, Head(0)
+{
+}
+
+FGRIDSharedRing::~FGRIDSharedRing()
+{
+	if (Region)
+	{
+		// Unlinks the name too; a client that already opened it keeps its mapping
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+		Region = nullptr;
+	}
+}
+
+bool FGRIDSharedRing::Create(const FString& InName, int64 InSize)
+{
+#if PLATFORM_LINUX || PLATFORM_MAC
+	// The engine creates the object world-readable, less the umask. Create it owner-only first
+	// so no other local user can open it in between, and fail if the name is already taken.
+	// The engine then maps the existing object.
+	const FTCHARToUTF8 PathUtf8(*(TEXT("/") + InName));
+	const int32 Fd = shm_open(PathUtf8.Get(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+	if (Fd < 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GRID] Failed to create shared memory region %s (errno %d)"), *InName, errno);
+		return false;
+	}
+#endif
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(InName, true,
+		FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write, InSize);
+
+#if PLATFORM_LINUX || PLATFORM_MAC
+	const bool bOwnerOnly = fchmod(Fd, S_IRUSR | S_IWUSR) == 0;
+	close(Fd);
+	if (Region && !bOwnerOnly)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GRID] Failed to restrict shared memory region %s (errno %d)"), *InName, errno);
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+		Region = nullptr;
+		return false;
+	}
+	if (!Region)
+	{
+		shm_unlink(PathUtf8.Get());
+	}
+#endif
+
+	if (!Region)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GRID] Failed to create shared memory region %s"), *InName);
+		return false;
+	}
+
+	Name = InName;
+	Size = static_cast<int64>(Region->GetSize());
+	return true;
+}
+
+uint8* FGRIDSharedRing::BeginWrite(int64& OutOffset, int64& OutCapacity)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	OutOffset = 0;
+	OutCapacity = 0;
+	if (!Region)
+	{
+		return nullptr;
+	}
+
+	if (Spans.Num() == 0)
+	{
+		Head = 0;
+		OutCapacity = Size;
+	}
+	else
+	{
+		const int64 Tail = Spans[0].Offset;
+		if (Head > Tail)
+		{
+			// Free space is split between the end of the region and its start; take the larger part
+			const int64 AtEnd = Size - Head;
+			OutOffset = AtEnd >= Tail ? Head : 0;
+			OutCapacity = FMath::Max(AtEnd, Tail);
+		}
+		else
+		{
+			// Already wrapped: free space runs from the head up to the oldest span
+			OutOffset = Head;
+			OutCapacity = Tail - Head;
+		}
+	}
+
+	return OutCapacity > 0 ? static_cast<uint8*>(Region->GetAddress()) + OutOffset : nullptr;
+}
+
+void FGRIDSharedRing::CommitWrite(int64 Offset, int64 Length)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	Spans.Add({ Offset, Length, false });
+	Head = Offset + Length;
+}
+
+bool FGRIDSharedRing::Release(int64 Offset, int64 Length)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FSpan* Span = Spans.FindByPredicate([Offset, Length](const FSpan& Candidate)
+	{
+		return Candidate.Offset == Offset && Candidate.Length == Length && !Candidate.bReleased;
+	});
+	if (!Span)
+	{
+		return false;
+	}
+
+	Span->bReleased = true;
+
+	int32 NumReclaimed = 0;
+	while (NumReclaimed < Spans.Num() && Spans[NumReclaimed].bReleased)
+	{
+		NumReclaimed++;
+	}
+	Spans.RemoveAt(0, NumReclaimed, EAllowShrinking::No);
+	return true;
+}
@@ -0,0 +1,222 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "GRIDSocketPoller.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "BSDSockets/SocketsBSD.h"
+
+#if PLATFORM_LINUX
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <winsock2.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#else
+#include <poll.h>
+#endif
+
+namespace
+{
+	constexpr uint64 WakeupKey = MAX_uint64;
+}
+
+#if PLATFORM_LINUX
+
+namespace
+{
+	int32 GetNativeHandle(FSocket* Socket)
+	{
+		return static_cast<int32>(static_cast<FSocketBSD*>(Socket)->GetNativeSocket());
+	}
+}
+
+FGRIDSocketPoller::FGRIDSocketPoller()
+	: EpollFd(-1)
+	, WakeupFd(-1)
+{
+}
+
+FGRIDSocketPoller::~FGRIDSocketPoller()
+{
+	if (WakeupFd >= 0)
+	{
+		close(WakeupFd);
+	}
+	if (EpollFd >= 0)
+	{
+		close(EpollFd);
+	}
+}
+
+bool FGRIDSocketPoller::Init()
+{
+	EpollFd = epoll_create1(EPOLL_CLOEXEC);
+	WakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (EpollFd < 0 || WakeupFd < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to create epoll instance (errno %d)"), errno);
+		return false;
+	}
+
+	epoll_event Event = {};
+	Event.events = EPOLLIN;
+	Event.data.u64 = WakeupKey;
+	return epoll_ctl(EpollFd, EPOLL_CTL_ADD, WakeupFd, &Event) == 0;
+}
+
+bool FGRIDSocketPoller::Add(FSocket* Socket, uint64 Key)
+{
+	epoll_event Event = {};
+	Event.events = EPOLLIN | EPOLLRDHUP;
+	Event.data.u64 = Key;
+	return epoll_ctl(EpollFd, EPOLL_CTL_ADD, GetNativeHandle(Socket), &Event) == 0;
+}
+
+void FGRIDSocketPoller::Remove(FSocket* Socket)
+{
+	epoll_ctl(EpollFd, EPOLL_CTL_DEL, GetNativeHandle(Socket), nullptr);
+}
+
+void FGRIDSocketPoller::Wait(TArray<uint64>& OutReadyKeys, double TimeoutSeconds)
+{
+	epoll_event Events[64];
+	const int32 TimeoutMs = TimeoutSeconds < 0.0 ? -1 : FMath::CeilToInt(TimeoutSeconds * 1000.0);
+	const int32 Count = epoll_wait(EpollFd, Events, UE_ARRAY_COUNT(Events), TimeoutMs);
+
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		if (Events[Index].data.u64 == WakeupKey)
+		{
+			uint64 Value = 0;
+			read(WakeupFd, &Value, sizeof(Value));
+			continue;
+		}
+		OutReadyKeys.Add(Events[Index].data.u64);
+	}
+}
+
+void FGRIDSocketPoller::Wakeup()
+{
+	const uint64 Value = 1;
+	write(WakeupFd, &Value, sizeof(Value));
+}
+
+#else
+
+namespace
+{
+#if PLATFORM_WINDOWS
+	using FPollFd = WSAPOLLFD;
+#else
+	using FPollFd = pollfd;
+#endif
+
+	FPollFd MakePollFd(FSocket* Socket)
+	{
+		FPollFd PollFd = {};
+		PollFd.fd = static_cast<FSocketBSD*>(Socket)->GetNativeSocket();
+		PollFd.events = POLLIN;
+		return PollFd;
+	}
+
+	int32 PollSockets(FPollFd* PollFds, int32 Count, int32 TimeoutMs)
+	{
+#if PLATFORM_WINDOWS
+		return WSAPoll(PollFds, static_cast<ULONG>(Count), TimeoutMs);
+#else
+		return poll(PollFds, static_cast<nfds_t>(Count), TimeoutMs);
+#endif
+	}
+}
+
+FGRIDSocketPoller::FGRIDSocketPoller()
+	: WakeupSocket(nullptr)
+{
+}
+
+FGRIDSocketPoller::~FGRIDSocketPoller()
+{
+	if (WakeupSocket)
+	{
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(WakeupSocket);
+		WakeupSocket = nullptr;
+	}
+}
+
+bool FGRIDSocketPoller::Init()
+{
+	// Bound to an ephemeral loopback port; Wakeup() sends a byte to that same port
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	WakeupSocket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("GRIDPollerWakeup"), FNetworkProtocolTypes::IPv4);
+	WakeupAddress = SocketSubsystem->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+	WakeupAddress->SetLoopbackAddress();
+	WakeupAddress->SetPort(0);
+	if (!WakeupSocket || !WakeupSocket->Bind(*WakeupAddress) || !WakeupSocket->SetNonBlocking(true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GRID] Failed to create poller wakeup socket"));
+		return false;
+	}
+	WakeupSocket->GetAddress(*WakeupAddress);
+	return true;
+}
+
+bool FGRIDSocketPoller::Add(FSocket* Socket, uint64 Key)
+{
+	Sockets.Add(Socket, Key);
+	return true;
+}
+
+void FGRIDSocketPoller::Remove(FSocket* Socket)
+{
+	Sockets.Remove(Socket);
+}
+
+void FGRIDSocketPoller::Wait(TArray<uint64>& OutReadyKeys, double TimeoutSeconds)
+{
+	TArray<FPollFd, TInlineAllocator<16>> PollFds;
+	TArray<uint64, TInlineAllocator<16>> Keys;
+	PollFds.Add(MakePollFd(WakeupSocket));
+	Keys.Add(WakeupKey);
+	for (const TPair<FSocket*, uint64>& Pair : Sockets)
+	{
+		PollFds.Add(MakePollFd(Pair.Key));
+		Keys.Add(Pair.Value);
+	}
+
+	const int32 TimeoutMs = TimeoutSeconds < 0.0 ? -1 : FMath::CeilToInt(TimeoutSeconds * 1000.0);
+	if (PollSockets(PollFds.GetData(), PollFds.Num(), TimeoutMs) <= 0)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < PollFds.Num(); Index++)
+	{
+		// A closed or failed socket reports readable too, so its reader notices
+		if ((PollFds[Index].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+		{
+			continue;
+		}
+		if (Keys[Index] == WakeupKey)
+		{
+			uint8 Buffer[64];
+			int32 BytesRead = 0;
+			while (WakeupSocket->Recv(Buffer, sizeof(Buffer), BytesRead) && BytesRead > 0)
+			{
+			}
+			continue;
+		}
+		OutReadyKeys.Add(Keys[Index]);
+	}
+}
+
+void FGRIDSocketPoller::Wakeup()
+{
+	const uint8 Byte = 1;
+	int32 BytesSent = 0;
+	WakeupSocket->SendTo(&Byte, 1, BytesSent, *WakeupAddress);
+}
+
+#endif
@@ -0,0 +1,102 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#include "GRIDUnixSocket.h"
+#include "SocketSubsystem.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Paths.h"
+
+#if PLATFORM_LINUX
+#include "BSDSockets/SocketsBSD.h"
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#if PLATFORM_LINUX
+
+bool FGRIDUnixSocket::IsSupported()
+{
+	return true;
+}
+
+FString FGRIDUnixSocket::GetDefaultPath()
+{
+	FString Directory = FPlatformMisc::GetEnvironmentVariable(TEXT("XDG_RUNTIME_DIR"));
+	if (Directory.IsEmpty())
+	{
+		Directory = FPlatformProcess::UserTempDir();
+	}
+	return FPaths::Combine(Directory, FString::Printf(TEXT("grid-bridge-%u.sock"), FPlatformProcess::GetCurrentProcessId()));
+}
+
+FSocket* FGRIDUnixSocket::CreateListener(const FString& SocketPath, int32 Backlog)
+{
+	sockaddr_un Address = {};
+	Address.sun_family = AF_UNIX;
+
+	const FTCHARToUTF8 PathUtf8(*SocketPath);
+	if (PathUtf8.Length() >= static_cast<int32>(sizeof(Address.sun_path)))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GRID] Unix socket path too long: %s"), *SocketPath);
+		return nullptr;
+	}
+	FMemory::Memcpy(Address.sun_path, PathUtf8.Get(), PathUtf8.Length());
+
+	const int32 Fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (Fd < 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GRID] Failed to create unix socket (errno %d)"), errno);
+		return nullptr;
+	}
+
+	// A stale file from a crashed editor would make bind fail
+	unlink(PathUtf8.Get());
+
+	// Make the file owner-only before listening, so no other local user can ever connect.
+	// chmod rather than umask, which would apply to files other editor threads create meanwhile
+	if (bind(Fd, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0
+		|| chmod(PathUtf8.Get(), S_IRUSR | S_IWUSR) != 0
+		|| listen(Fd, Backlog) != 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GRID] Failed to listen on unix socket %s (errno %d)"), *SocketPath, errno);
+		close(Fd);
+		unlink(PathUtf8.Get());
+		return nullptr;
+	}
+
+	// Wrapping the descriptor gives Accept/Recv/Send/Wait the same behavior as the TCP listener
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	FSocket* Listener = new FSocketBSD(Fd, SOCKTYPE_Streaming, TEXT("GRIDUnixListener"), NAME_None, SocketSubsystem);
+	Listener->SetNonBlocking(true);
+	return Listener;
+}
+
+void FGRIDUnixSocket::DeleteSocketFile(const FString& SocketPath)
+{
+	unlink(TCHAR_TO_UTF8(*SocketPath));
+}
+
+#else
+
+bool FGRIDUnixSocket::IsSupported()
+{
+	return false;
+}
+
+FString FGRIDUnixSocket::GetDefaultPath()
+{
+	return FString();
+}
+
+FSocket* FGRIDUnixSocket::CreateListener(const FString& SocketPath, int32 Backlog)
+{
+	return nullptr;
+}
+
+void FGRIDUnixSocket::DeleteSocketFile(const FString& SocketPath)
+{
+}
+
+#endif
@@ -0,0 +1,138 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+// Runs every command registered as AnyThread on a worker, the way Dispatch() does, and fails if
+// it reaches a path guarded by GRIDCheckGameThread(). Run it from the Session Frontend or with
+// "Automation RunTests GRID.Bridge" in an editor with the plugin loaded.
+
+#include "Commands/AssetCommands.h"
+#include "Core/ThreadCheck.h"
+#include "Core/ToolRegistry.h"
+#include "Async/Async.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Dom/JsonObject.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FWorkerRun
+	{
+		TSharedPtr<FJsonObject> Response;
+		TArray<FString> Violations;
+		bool bRanOnGameThread = false;
+	};
+
+	/** Call Handler on a pool thread inside a thread-check scope and wait for it */
+	FWorkerRun RunOnWorker(const FGRIDCommandHandler& Handler, const TSharedPtr<FJsonObject>& Params)
+	{
+		return AsyncPool(*GThreadPool, [&Handler, Params]()
+		{
+			FWorkerRun Run;
+			FGRIDThreadCheckScope Scope;
+			Run.bRanOnGameThread = IsInGameThread();
+			Run.Response = Handler(Params);
+			Run.Violations = Scope.GetViolations();
+			return Run;
+		}).Get();
+	}
+
+	void TestWorkerRun(FAutomationTestBase& Test, const FString& What, const FWorkerRun& Run)
+	{
+		Test.TestFalse(FString::Printf(TEXT("%s ran on a worker"), *What), Run.bRanOnGameThread);
+		Test.TestTrue(FString::Printf(TEXT("%s returned a response"), *What), Run.Response.IsValid());
+		for (const FString& Site : Run.Violations)
+		{
+			Test.AddError(FString::Printf(TEXT("%s reached game-thread-only %s"), *What, *Site));
+		}
+	}
+
+	/** Params that get each command past its argument checks */
+	TSharedPtr<FJsonObject> MakeParams(const FString& CommandName)
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		if (CommandName.StartsWith(TEXT("job_")))
+		{
+			Params->SetStringField(TEXT("job_id"), FGuid::NewGuid().ToString());
+		}
+		else if (CommandName == TEXT("asset_search"))
+		{
+			Params->SetStringField(TEXT("query"), TEXT("a"));
+		}
+		else if (CommandName == TEXT("asset_list_references"))
+		{
+			Params->SetStringField(TEXT("path"), TEXT("/Engine/BasicShapes/Cube.Cube"));
+		}
+		return Params;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGRIDAnyThreadCommandsTest, "GRID.Bridge.AnyThreadCommands",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGRIDAnyThreadCommandsTest::RunTest(const FString& Parameters)
+{
+	FGRIDToolRegistry& Registry = FGRIDToolRegistry::Get();
+
+	// Commands that must stay off the game thread; each is run below with the rest
+	static const TCHAR* ExpectedCommands[] = { TEXT("check_connection"), TEXT("bridge_stats"), TEXT("tools_list"),
+		TEXT("job_status"), TEXT("job_result"), TEXT("job_cancel"), TEXT("job_list"), TEXT("asset_search") };
+	for (const TCHAR* Name : ExpectedCommands)
+	{
+		TestTrue(FString::Printf(TEXT("%s is registered as AnyThread"), Name), Registry.GetThreadAffinity(Name) == EGRIDThreadAffinity::AnyThread);
+	}
+
+	for (const FGRIDToolMetadata& Tool : Registry.GetAllTools())
+	{
+		if (Tool.ThreadAffinity != EGRIDThreadAffinity::AnyThread)
+		{
+			continue;
+		}
+
+		const FGRIDCommand* Command = Registry.FindCommand(Tool.Name);
+		if (TestNotNull(FString::Printf(TEXT("%s has a handler"), *Tool.Name), Command))
+		{
+			TestWorkerRun(*this, Tool.Name, RunOnWorker(Command->Handler, MakeParams(Tool.Name)));
+		}
+	}
+
+	// asset_search answers from the index once it is ready and from the registry before; use a
+	// private index so both can be forced without touching the bridge's
+	FAssetCommands AssetCommands;
+	const FGRIDCommandHandler Search = [&AssetCommands](const TSharedPtr<FJsonObject>& Params) { return AssetCommands.Search(Params); };
+
+	TSharedPtr<FJsonObject> FuzzyParams = MakeParams(TEXT("asset_search"));
+	FuzzyParams->SetBoolField(TEXT("fuzzy"), true);
+
+	AssetCommands.AssetIndex.Reset();
+	AssetCommands.AssetIndex.AddAsset(FAssetData(FName(TEXT("/Game/GRIDTest/SM_Rock")), FName(TEXT("/Game/GRIDTest")), FName(TEXT("SM_Rock")),
+		FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("StaticMesh"))));
+	AssetCommands.AssetIndex.MarkReady();
+	TestWorkerRun(*this, TEXT("asset_search (index ready)"), RunOnWorker(Search, MakeParams(TEXT("asset_search"))));
+	TestWorkerRun(*this, TEXT("asset_search fuzzy (index ready)"), RunOnWorker(Search, FuzzyParams));
+
+	// Short queries match inside the name, as the registry fallback does
+	TSharedPtr<FJsonObject> ShortParams = MakeShared<FJsonObject>();
+	ShortParams->SetStringField(TEXT("query"), TEXT("ro"));
+	const FWorkerRun Short = RunOnWorker(Search, ShortParams);
+	TestWorkerRun(*this, TEXT("asset_search two characters (index ready)"), Short);
+	const TSharedPtr<FJsonObject>* ShortData = nullptr;
+	if (Short.Response.IsValid() && Short.Response->TryGetObjectField(TEXT("data"), ShortData))
+	{
+		TestEqual(TEXT("Two-character query matches mid-name"), (*ShortData)->GetIntegerField(TEXT("total")), 1);
+	}
+
+	// Folders outside /Game aren't indexed and go to the registry even when the index is ready
+	TSharedPtr<FJsonObject> EngineParams = MakeParams(TEXT("asset_search"));
+	EngineParams->SetStringField(TEXT("path"), TEXT("/Engine/BasicShapes"));
+	TestWorkerRun(*this, TEXT("asset_search outside /Game (index ready)"), RunOnWorker(Search, EngineParams));
+
+	AssetCommands.AssetIndex.Reset();
+	TestFalse(TEXT("Reset index is not ready"), AssetCommands.AssetIndex.IsReady());
+	TestWorkerRun(*this, TEXT("asset_search (index not ready)"), RunOnWorker(Search, MakeParams(TEXT("asset_search"))));
+	TestWorkerRun(*this, TEXT("asset_search fuzzy (index not ready)"), RunOnWorker(Search, FuzzyParams));
+
+	return true;
+}
+
+#endif
@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Core/CursorStore.h"
+#include "Core/ActorIndex.h"
+
+class FGRIDToolRegistry;
 
 /**
  * Handles Level Actor commands from GRID IDE.
@@ -15,11 +19,13 @@ public:
 	FActorCommands();
 	~FActorCommands();
 
-	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/** Add this family's commands to the bridge dispatch table */
+	void RegisterCommands(FGRIDToolRegistry& Registry);
 
 private:
 	TSharedPtr<FJsonObject> ListActors(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> FindActors(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> QueryRegion(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> SpawnActor(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> DeleteActor(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> GetActorInfo(const TSharedPtr<FJsonObject>& Params);
@@ -34,6 +40,9 @@ private:
 	TSharedPtr<FJsonObject> SelectActor(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> RenameActor(const TSharedPtr<FJsonObject>& Params);
 
-	TSharedPtr<FJsonObject> CreateError(const FString& Code, const FString& Message);
-	TSharedPtr<FJsonObject> CreateSuccess(const TSharedPtr<FJsonObject>& Data = nullptr);
+	/** actor_list snapshots, ordered by actor path, behind its continuation tokens */
+	TGRIDCursorStore<TWeakObjectPtr<AActor>> ActorCursors;
+
+	/** Editor-world actors by label, class, tag and bounds, for actor_find, region queries and by-name lookups */
+	FGRIDActorIndex ActorIndex;
 };
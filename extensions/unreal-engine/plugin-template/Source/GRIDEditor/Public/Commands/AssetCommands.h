@@ -4,6 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "AssetRegistry/AssetData.h"
+#include "Core/CursorStore.h"
+#include "Core/AssetIndex.h"
+
+class FGRIDToolRegistry;
 
 /**
  * Handles Asset commands from GRID IDE.
@@ -15,7 +20,8 @@ public:
 	FAssetCommands();
 	~FAssetCommands();
 
-	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/** Add this family's commands to the bridge dispatch table */
+	void RegisterCommands(FGRIDToolRegistry& Registry);
 
 private:
 	TSharedPtr<FJsonObject> Search(const TSharedPtr<FJsonObject>& Params);
@@ -28,6 +34,12 @@ private:
 	TSharedPtr<FJsonObject> ListReferences(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> Open(const TSharedPtr<FJsonObject>& Params);
 
-	TSharedPtr<FJsonObject> CreateError(const FString& Code, const FString& Message);
-	TSharedPtr<FJsonObject> CreateSuccess(const TSharedPtr<FJsonObject>& Data = nullptr);
+	/** asset_search matches, ordered by object path or, for fuzzy searches, by rank, behind its continuation tokens */
+	TGRIDCursorStore<FAssetData> SearchCursors;
+
+	/** Names of assets under /Game, so a search doesn't enumerate the registry */
+	FGRIDAssetIndex AssetIndex;
+
+	/** Runs Search on a worker with the index ready and not ready */
+	friend class FGRIDAnyThreadCommandsTest;
 };
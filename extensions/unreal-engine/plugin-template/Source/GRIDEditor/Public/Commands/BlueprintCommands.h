@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class FGRIDToolRegistry;
+
 /**
  * Handles Blueprint manipulation commands from GRID IDE.
  * Supports: create, compile, get_info, set_property, add_component, add_variable, add_function, etc.
@@ -15,8 +17,8 @@ public:
 	FBlueprintCommands();
 	~FBlueprintCommands();
 
-	/** Route command to appropriate handler */
-	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/** Add this family's commands to the bridge dispatch table */
+	void RegisterCommands(FGRIDToolRegistry& Registry);
 
 private:
 	// Blueprint Lifecycle
@@ -53,7 +55,5 @@ private:
 	TSharedPtr<FJsonObject> ListNodes(const TSharedPtr<FJsonObject>& Params);
 
 	// Helpers
-	TSharedPtr<FJsonObject> CreateError(const FString& Code, const FString& Message);
-	TSharedPtr<FJsonObject> CreateSuccess(const TSharedPtr<FJsonObject>& Data = nullptr);
 	class UBlueprint* LoadBlueprint(const FString& Path);
 };
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class FGRIDToolRegistry;
+
 /**
  * Handles Enhanced Input commands from GRID IDE.
  * Supports: create_action, create_context, add_mapping, list_keys, modifiers, triggers, etc.
@@ -15,7 +17,8 @@ public:
 	FInputCommands();
 	~FInputCommands();
 
-	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/** Add this family's commands to the bridge dispatch table */
+	void RegisterCommands(FGRIDToolRegistry& Registry);
 
 private:
 	// Input Actions
@@ -41,7 +44,4 @@ private:
 	TSharedPtr<FJsonObject> AddTrigger(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> RemoveTrigger(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> ListTriggers(const TSharedPtr<FJsonObject>& Params);
-
-	TSharedPtr<FJsonObject> CreateError(const FString& Code, const FString& Message);
-	TSharedPtr<FJsonObject> CreateSuccess(const TSharedPtr<FJsonObject>& Data = nullptr);
 };
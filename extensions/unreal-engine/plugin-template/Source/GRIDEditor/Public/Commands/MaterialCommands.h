@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class FGRIDToolRegistry;
+
 /**
  * Handles Material commands from GRID IDE.
  * Supports: create, get_info, set_property, create_instance, node manipulation, etc.
@@ -15,7 +17,8 @@ public:
 	FMaterialCommands();
 	~FMaterialCommands();
 
-	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/** Add this family's commands to the bridge dispatch table */
+	void RegisterCommands(FGRIDToolRegistry& Registry);
 
 private:
 	TSharedPtr<FJsonObject> CreateMaterial(const TSharedPtr<FJsonObject>& Params);
@@ -34,7 +37,4 @@ private:
 	TSharedPtr<FJsonObject> DeleteNode(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> ConnectNodes(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> ListNodes(const TSharedPtr<FJsonObject>& Params);
-
-	TSharedPtr<FJsonObject> CreateError(const FString& Code, const FString& Message);
-	TSharedPtr<FJsonObject> CreateSuccess(const TSharedPtr<FJsonObject>& Data = nullptr);
 };
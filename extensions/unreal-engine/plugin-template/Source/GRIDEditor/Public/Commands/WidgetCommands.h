@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class FGRIDToolRegistry;
+
 /**
  * Handles UMG Widget commands from GRID IDE.
  * Supports: create, list_components, add_component, set_property, bind_events, etc.
@@ -15,7 +17,8 @@ public:
 	FWidgetCommands();
 	~FWidgetCommands();
 
-	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/** Add this family's commands to the bridge dispatch table */
+	void RegisterCommands(FGRIDToolRegistry& Registry);
 
 private:
 	TSharedPtr<FJsonObject> CreateWidgetBlueprint(const TSharedPtr<FJsonObject>& Params);
@@ -29,7 +32,4 @@ private:
 	TSharedPtr<FJsonObject> ValidateHierarchy(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> GetAvailableEvents(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> BindEvents(const TSharedPtr<FJsonObject>& Params);
-
-	TSharedPtr<FJsonObject> CreateError(const FString& Code, const FString& Message);
-	TSharedPtr<FJsonObject> CreateSuccess(const TSharedPtr<FJsonObject>& Data = nullptr);
 };
@@ -0,0 +1,154 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Math/GenericOctree.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+struct FConvexVolume;
+struct FPropertyChangedEvent;
+
+/**
+ * An actor's bounds in the spatial index.
+ */
+struct FGRIDActorOctreeElement
+{
+	TWeakObjectPtr<AActor> Actor;
+	FBoxCenterAndExtent Bounds;
+
+	/** Where the octree keeps the element, shared with the index entry so it can be removed */
+	TSharedPtr<FOctreeElementId2> Id;
+};
+
+struct FGRIDActorOctreeSemantics
+{
+	enum { MaxElementsPerLeaf = 16 };
+	enum { MinInclusiveElementsPerNode = 7 };
+	enum { MaxNodeDepth = 12 };
+
+	typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+	FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FGRIDActorOctreeElement& Element) { return Element.Bounds; }
+	FORCEINLINE static bool AreElementsEqual(const FGRIDActorOctreeElement& A, const FGRIDActorOctreeElement& B) { return A.Actor == B.Actor; }
+	FORCEINLINE static void SetElementId(const FGRIDActorOctreeElement& Element, FOctreeElementId2 Id) { *Element.Id = Id; }
+	FORCEINLINE static void ApplyOffset(FGRIDActorOctreeElement& Element, const FVector& Offset) { Element.Bounds.Center += Offset; }
+};
+
+using FGRIDActorOctree = TOctree2<FGRIDActorOctreeElement, FGRIDActorOctreeSemantics>;
+
+/**
+ * Lookup tables over one world's actors by label, class and tag, and an octree of their bounds.
+ * Built on first use and kept current from the editor's actor added, deleted, moved and
+ * relabelled notifications; a different world, a streamed level or an undo marks it for a
+ * rebuild on the next lookup. Labels compare case-insensitively. Game thread only.
+ * Moves are seen through PostEditMove, so code that moves actors should finish with PostEditMove(true).
+ */
+class GRIDEDITOR_API FGRIDActorIndex
+{
+public:
+	FGRIDActorIndex();
+	~FGRIDActorIndex();
+
+	/** Actors in World labelled Label */
+	void FindByLabel(UWorld* World, const FString& Label, TArray<AActor*>& OutActors);
+
+	/** First actor in World labelled Label, or null */
+	AActor* FindFirstByLabel(UWorld* World, const FString& Label);
+
+	/** Actors in World whose class is named ClassName; subclasses are not included */
+	void FindByClass(UWorld* World, FName ClassName, TArray<AActor*>& OutActors);
+
+	/** Actors in World carrying Tag */
+	void FindByTag(UWorld* World, FName Tag, TArray<AActor*>& OutActors);
+
+	/** Actors in World whose bounds intersect a sphere */
+	void QuerySphere(UWorld* World, const FVector& Center, double Radius, TArray<AActor*>& OutActors);
+
+	/** Actors in World whose bounds intersect a box */
+	void QueryBox(UWorld* World, const FBox& Box, TArray<AActor*>& OutActors);
+
+	/** Actors in World whose bounds intersect a convex volume such as a view frustum */
+	void QueryFrustum(UWorld* World, const FConvexVolume& Frustum, TArray<AActor*>& OutActors);
+
+	/**
+	 * Up to Count actors in World nearest to Point, closest first, with their distance to Point.
+	 * Distance is measured to an actor's bounds, so a point inside them is at distance 0.
+	 * Actors rejected by Filter don't count towards Count.
+	 */
+	void QueryNearest(UWorld* World, const FVector& Point, int32 Count, double MaxDistance, TArray<TPair<AActor*, double>>& OutActors,
+		const TFunction<bool(AActor*)>& Filter = nullptr);
+
+	/** Visit every indexed actor in World with its label; stops when Visitor returns false */
+	void ForEach(UWorld* World, TFunctionRef<bool(AActor*, const FString&)> Visitor);
+
+	/** Actors indexed for the current world */
+	int32 Num() const { return Entries.Num(); }
+
+	/** Full rebuilds so far, including the first build */
+	int32 GetRebuildCount() const { return RebuildCount; }
+
+private:
+	struct FEntry
+	{
+		FString Label;
+		FName ClassName;
+		TArray<FName> Tags;
+
+		/** Octree slot; null for actors without a root component */
+		TSharedPtr<FOctreeElementId2> OctreeId;
+	};
+
+	/** Rebuild if World is not the indexed world or the index was invalidated */
+	void EnsureWorld(UWorld* World);
+	void Rebuild(UWorld* World);
+
+	void AddActor(AActor* Actor);
+	void RemoveActor(const TWeakObjectPtr<AActor>& Actor);
+
+	/** Refresh an indexed actor's label, tags and bounds */
+	void ReindexActor(AActor* Actor);
+
+	/** Whether an editor notification is about an actor of the indexed world */
+	bool IsTracked(const AActor* Actor) const;
+
+	/** Run Visitor for every live actor in the octree whose bounds overlap Bounds */
+	void VisitBox(const FBoxCenterAndExtent& Bounds, TFunctionRef<void(AActor*, const FBox&)> Visitor) const;
+
+	/** Live actors of a bucket, in no particular order */
+	static void Collect(const TSet<TWeakObjectPtr<AActor>>* Bucket, TArray<AActor*>& OutActors);
+
+	void Subscribe();
+	void Unsubscribe();
+
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnActorMoved(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void OnLevelsChanged(ULevel* Level, UWorld* World);
+	void Invalidate();
+
+	TWeakObjectPtr<UWorld> IndexedWorld;
+	bool bDirty = true;
+	int32 RebuildCount = 0;
+
+	TMap<TWeakObjectPtr<AActor>, FEntry> Entries;
+	TMap<FString, TSet<TWeakObjectPtr<AActor>>> ByLabel;
+	TMap<FName, TSet<TWeakObjectPtr<AActor>>> ByClass;
+	TMap<FName, TSet<TWeakObjectPtr<AActor>>> ByTag;
+	TUniquePtr<FGRIDActorOctree> Octree;
+
+	bool bSubscribed = false;
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle LabelChangedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle UndoRedoHandle;
+};
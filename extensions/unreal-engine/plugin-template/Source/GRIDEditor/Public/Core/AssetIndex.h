@@ -0,0 +1,136 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "AssetRegistry/AssetData.h"
+#include <atomic>
+
+class IAssetEditorInstance;
+
+/**
+ * What lifts one fuzzy asset match above another that matches the query as well.
+ */
+struct FGRIDAssetRankOptions
+{
+	/** Assets of this class score higher */
+	FTopLevelAssetPath PreferredClass;
+
+	/** Assets score higher the more leading folders they share with this one */
+	FString NearFolder;
+};
+
+/**
+ * In-memory name index over the project's assets under /Game, for asset_search.
+ * Built once the asset registry finishes its initial scan and kept current from its added,
+ * removed and renamed events. A query matches names containing it, ignoring case; candidates
+ * come from trigram postings, or bigram postings for two-character queries, and a one-character
+ * query scans every name. Folders are matched by path prefix. Ranked searches score every name with
+ * FGRIDFuzzyScorer and keep the best in a bounded heap; assets opened in an editor recently rank
+ * higher. Updates happen on the game thread; queries may run on any thread.
+ */
+class GRIDEDITOR_API FGRIDAssetIndex
+{
+public:
+	FGRIDAssetIndex();
+	~FGRIDAssetIndex();
+
+	/** Build now if the registry has finished scanning, otherwise once it has, and follow its events; game thread */
+	void Start();
+
+	/** Stop following registry events; game thread */
+	void Stop();
+
+	/** Whether the index holds the registry's assets; until then callers should query the registry */
+	bool IsReady() const { return bReady; }
+
+	/** Whether searches inside Folder can be answered from the index; others should query the registry */
+	static bool CoversFolder(const FString& Folder);
+
+	/**
+	 * Assets whose name matches Query (any name when empty), of class ClassPath when it is valid,
+	 * and inside Folder or its subfolders when it is not empty. Unordered. Any thread.
+	 */
+	void Find(const FString& Query, const FTopLevelAssetPath& ClassPath, const FString& Folder, TArray<FAssetData>& OutAssets) const;
+
+	/**
+	 * The MaxResults best fuzzy matches for Query, best first, filtered like Find. Ties keep
+	 * name order. Any thread.
+	 */
+	void FindRanked(const FString& Query, const FTopLevelAssetPath& ClassPath, const FString& Folder, const FGRIDAssetRankOptions& Options,
+		int32 MaxResults, TArray<FAssetData>& OutAssets) const;
+
+	/** Count an asset as just used, for the recent-use bonus of ranked searches */
+	void MarkUsed(const FSoftObjectPath& ObjectPath);
+
+	/** Add or replace an asset */
+	void AddAsset(const FAssetData& Asset);
+
+	/** Drop the asset with this object path, if indexed */
+	void RemoveAsset(const FSoftObjectPath& ObjectPath);
+
+	/** Assets currently indexed */
+	int32 Num() const;
+
+	/** Forget every asset; the index is not ready again until rebuilt */
+	void Reset();
+
+	/** Mark the index as holding a complete set of assets, e.g. after adding them by hand */
+	void MarkReady() { bReady = true; }
+
+private:
+	struct FEntry
+	{
+		FAssetData Asset;
+
+		/** Lowercase asset name the postings were built from */
+		FString Name;
+
+		/** Lowercase package path followed by '/', for folder prefix checks */
+		FString Folder;
+
+		/** Fuzzy-scoring masks, see FGRIDFuzzyScorer */
+		uint64 CharMask = 0;
+		uint64 WordStarts = 0;
+
+		/** When an editor last opened the asset; 0 if never */
+		double LastUsedTime = 0.0;
+
+		bool bLive = false;
+	};
+
+	/** Posting keys for a lowercase name: every distinct bigram and trigram */
+	static void GetIndexKeys(const FString& Name, TArray<uint64>& OutKeys);
+
+	/** Keys a lowercase query must all be indexed under, none for one character; any one of them yields a superset of the matches */
+	static void GetQueryKeys(const FString& Query, TArray<uint64>& OutKeys);
+
+	void RemoveSlot(int32 Slot);
+
+	/** Index every asset the registry knows under /Game; game thread */
+	void Build();
+
+	void OnFilesLoaded();
+	void OnAssetAdded(const FAssetData& Asset);
+	void OnAssetRemoved(const FAssetData& Asset);
+	void OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath);
+	void OnAssetOpenedInEditor(UObject* Asset, IAssetEditorInstance* Editor);
+
+	mutable FRWLock Lock;
+	TArray<FEntry> Entries;
+	TArray<int32> FreeSlots;
+	TMap<FSoftObjectPath, int32> SlotByPath;
+	TMap<uint64, TArray<int32>> Postings;
+	TMap<FTopLevelAssetPath, TArray<int32>> ByClass;
+	int32 LiveCount = 0;
+
+	std::atomic<bool> bReady{false};
+
+	bool bStarted = false;
+	FDelegateHandle FilesLoadedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetOpenedHandle;
+};
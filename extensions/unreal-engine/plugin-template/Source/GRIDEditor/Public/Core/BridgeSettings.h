@@ -0,0 +1,57 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Bridge configuration loaded from the plugin's DefaultGRID.ini.
+ * Values not present in the config keep their defaults.
+ */
+struct GRIDEDITOR_API FGRIDBridgeSettings
+{
+	/** Seconds a client connection may stay idle before the server closes it */
+	float ConnectionIdleTimeoutSeconds = 300.0f;
+
+	/** Clients connected at once, and the size of the pool that serializes and sends responses; requests are read on the server thread */
+	int32 MaxConnections = 8;
+
+	/** Seconds before an unanswered request is answered with TIMEOUT */
+	float RequestTimeoutSeconds = 30.0f;
+
+	/** Also listen on a Unix domain socket where the platform supports it */
+	bool bEnableUnixSocket = true;
+
+	/** Size of the per-connection shared-memory ring offered for bulk responses; 0 disables it */
+	int32 SharedMemoryRingMB = 64;
+
+	/** Responses at least this large go through the ring instead of the socket */
+	int32 SharedMemoryThresholdKB = 64;
+
+	/** Game-thread time the bridge may spend on commands per editor frame; the rest waits for the next frame */
+	float GameThreadBudgetMs = 5.0f;
+
+	/** Per-frame budget that replaces GameThreadBudgetMs while Play In Editor runs */
+	float PIEGameThreadBudgetMs = 1.0f;
+
+	/** Hold bulk commands (saves, compiles, imports) until Play In Editor ends */
+	bool bDeferBulkDuringPIE = true;
+
+	/** Items per chunk when a paginated command is streamed without an explicit limit */
+	int32 StreamPageSize = 500;
+
+	/** Requests one connection may have in flight; more are answered with BUSY */
+	int32 MaxInFlightPerConnection = 64;
+
+	/** Commands queued or running across all connections, jobs included; more are answered with BUSY */
+	int32 MaxPendingCommands = 512;
+
+	/** Turn off the editor's background CPU throttling while a client is connected or work is pending */
+	bool bKeepEditorAwake = true;
+
+	/** Register commands that exist only for measuring the bridge, such as bridge_payload; read when the bridge is created */
+	bool bEnableBenchmarkCommands = false;
+
+	/** Load settings from the [/Script/GRIDEditor.GRIDEditorSettings] section */
+	static FGRIDBridgeSettings Load();
+};
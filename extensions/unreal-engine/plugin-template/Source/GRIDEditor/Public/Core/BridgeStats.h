@@ -0,0 +1,55 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Thread-safe counters for bridge connections and command latency.
+ * Reported to GRID IDE through the bridge_stats command.
+ */
+class GRIDEDITOR_API FGRIDBridgeStats
+{
+public:
+	void RecordConnectionOpened();
+	void RecordConnectionClosed(int32 RequestsServed);
+
+	/** Record the end-to-end latency of one command and whether the editor had focus when it ran */
+	void RecordCommand(const FString& CommandType, double LatencySeconds, bool bForeground = true);
+
+	/** Record a command skipped because it was cancelled or expired while queued */
+	void RecordDropped(const FString& CommandType);
+
+	/** Record a request answered with BUSY; bGlobal when the bridge-wide limit was hit rather than the connection's */
+	void RecordRejected(bool bGlobal);
+
+	int32 GetActiveConnections() const;
+
+	TSharedPtr<FJsonObject> ToJson() const;
+
+private:
+	struct FLatency
+	{
+		int64 Count = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+
+		void Add(double Seconds);
+		TSharedPtr<FJsonObject> ToJson() const;
+	};
+
+	mutable FCriticalSection Lock;
+	int64 ConnectionsOpened = 0;
+	int32 ActiveConnections = 0;
+	int64 RequestsOnClosedConnections = 0;
+	int64 Dropped = 0;
+	int64 RejectedPerConnection = 0;
+	int64 RejectedGlobal = 0;
+	TMap<FString, int64> DroppedPerCommand;
+	FLatency Overall;
+	FLatency Foreground;
+	FLatency Background;
+	TMap<FString, FLatency> PerCommand;
+};
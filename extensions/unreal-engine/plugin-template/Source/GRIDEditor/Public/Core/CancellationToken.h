@@ -0,0 +1,50 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Cancellation state shared between a request and the command running for it.
+ * A token is cancelled explicitly (cancel command, timeout reply) or implicitly once its
+ * deadline passes. Commands check it before they start, and long-running handlers between steps.
+ */
+class GRIDEDITOR_API FGRIDCancellationToken
+{
+public:
+	/** A deadline of 0 never expires */
+	explicit FGRIDCancellationToken(double InDeadline = 0.0);
+
+	void Cancel() { bCancelled = true; }
+
+	/** Whether the command should stop: cancelled or past its deadline */
+	bool IsCancelled() const;
+
+	/** Absolute deadline in FPlatformTime::Seconds(), or 0 for none */
+	double GetDeadline() const { return Deadline; }
+
+	/** Move the deadline, e.g. when a streamed command shows progress */
+	void SetDeadline(double InDeadline) { Deadline = InDeadline; }
+
+	/** Token of the command running on this thread; null outside bridge commands */
+	static const FGRIDCancellationToken* GetCurrent();
+
+	/** Whether the command running on this thread should stop */
+	static bool IsCurrentCancelled();
+
+	/** Makes a token current on this thread while a command runs */
+	class GRIDEDITOR_API FScope
+	{
+	public:
+		explicit FScope(const FGRIDCancellationToken* Token);
+		~FScope();
+
+	private:
+		const FGRIDCancellationToken* Previous;
+	};
+
+private:
+	std::atomic<bool> bCancelled{false};
+	std::atomic<double> Deadline;
+};
@@ -0,0 +1,115 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Core/ToolRegistry.h"
+#include <atomic>
+
+/**
+ * Runs bridge work on the game thread within a per-frame time budget.
+ * Tasks are queued from any thread and drained by a core ticker; whatever does not fit
+ * in a frame's budget carries over to the next. At least one task runs per frame.
+ * Interactive tasks always run before bulk ones, and the interactive lane is checked again
+ * after every bulk task, so interactive work never waits behind more than one bulk task.
+ * During Play In Editor a stricter budget applies and bulk tasks can be held back until it ends.
+ * The bridge's share of each frame is published as the GRIDBridge stat group and CSV category.
+ */
+class GRIDEDITOR_API FGRIDCommandScheduler
+{
+public:
+	using FTask = TUniqueFunction<void()>;
+
+	FGRIDCommandScheduler();
+	~FGRIDCommandScheduler();
+
+	/** Register the ticker; call on the game thread */
+	void Start(float InFrameBudgetMs, float InPIEFrameBudgetMs, bool bInDeferBulkDuringPIE);
+
+	/** Switch to the PIE budget while a session runs; call on the game thread */
+	void SetPlayInEditor(bool bInPlayInEditor);
+
+	/** Unregister the ticker and drop queued tasks; call on the game thread */
+	void Stop();
+
+	/** Queue a task for the game thread in a lane. Any thread. */
+	void Enqueue(FTask&& Task, EGRIDCommandPriority Priority = EGRIDCommandPriority::Interactive);
+
+	int32 GetQueueDepth() const { return Lanes[0].Depth.GetValue() + Lanes[1].Depth.GetValue(); }
+
+	/** Average game-thread time per task so far; 0 before any task has run. Any thread. */
+	double GetAverageTaskSeconds() const;
+
+	/** When the ticker last ran, in FPlatformTime::Seconds(); 0 before the first frame. Any thread. */
+	double GetLastTickTime() const { return LastTickTime; }
+
+	/** When a task last finished running; 0 if none has. Any thread. */
+	double GetLastTaskTime() const { return LastTaskTime; }
+
+	/** Queue depth, per-lane wait and per-frame bridge time, for bridge_stats */
+	TSharedPtr<FJsonObject> ToJson() const;
+
+private:
+	struct FQueuedTask
+	{
+		FTask Task;
+		double EnqueueTime = 0.0;
+	};
+
+	struct FLane
+	{
+		TQueue<FQueuedTask, EQueueMode::Mpsc> Queue;
+		FThreadSafeCounter Depth;
+
+		/** Tasks queued by tasks of the current frame; they wait for the next one */
+		int32 QueuedThisFrame = 0;
+
+		// Metrics, written by the ticker under StatsLock
+		int64 TasksRun = 0;
+		double TotalWaitSeconds = 0.0;
+		double MaxWaitSeconds = 0.0;
+
+		int32 Available() const { return Depth.GetValue() - QueuedThisFrame; }
+	};
+
+	bool Tick(float DeltaTime);
+
+	FLane& GetLane(EGRIDCommandPriority Priority) { return Lanes[static_cast<int32>(Priority)]; }
+
+	/** Indexed by EGRIDCommandPriority */
+	FLane Lanes[2];
+	FTSTicker::FDelegateHandle TickerHandle;
+	double FrameBudgetSeconds;
+	double PIEFrameBudgetSeconds;
+	bool bDeferBulkDuringPIE = true;
+
+	/** Whether a PIE session is running; written on the game thread */
+	std::atomic<bool> bPlayInEditor{false};
+
+	/** Set on the game thread while the ticker runs tasks */
+	bool bTicking = false;
+
+	// Game-thread liveness, read by the heartbeat on the server thread
+	std::atomic<double> LastTickTime{0.0};
+	std::atomic<double> LastTaskTime{0.0};
+
+	// Metrics, written by the ticker
+	mutable FCriticalSection StatsLock;
+	int64 TasksRun = 0;
+	int64 FramesWithWork = 0;
+	int64 FramesOverBudget = 0;
+	int64 FramesCarriedOver = 0;
+	int32 MaxQueueDepth = 0;
+	double LastFrameSeconds = 0.0;
+	double TotalFrameSeconds = 0.0;
+	double MaxFrameSeconds = 0.0;
+	int64 PIEFramesWithWork = 0;
+	int64 PIEFramesOverBudget = 0;
+	int64 PIEFramesBulkDeferred = 0;
+	double PIETotalFrameSeconds = 0.0;
+	double PIEMaxFrameSeconds = 0.0;
+};
@@ -0,0 +1,119 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+
+/**
+ * Snapshots behind paginated command results.
+ * The first page of a listing stores its ordered items; continuation tokens of the form
+ * "<snapshot>:<position>" resume from them, so later pages are neither shifted nor
+ * duplicated by changes made in between. Snapshots expire and the oldest are evicted.
+ */
+template <typename ItemType>
+class TGRIDCursorStore
+{
+public:
+	using FSnapshot = TArray<ItemType>;
+
+	/** Snapshots unused for this long are dropped */
+	static constexpr double ExpirySeconds = 300.0;
+
+	/** Snapshots kept at once; the least recently used is evicted first */
+	static constexpr int32 MaxSnapshots = 32;
+
+	/** Look up the snapshot a token refers to; null if the token is malformed, unknown or expired */
+	TSharedPtr<const FSnapshot> Resume(const FString& Token, FGuid& OutId, int32& OutPosition)
+	{
+		FString IdString;
+		FString PositionString;
+		if (!Token.Split(TEXT(":"), &IdString, &PositionString) || !FGuid::Parse(IdString, OutId)
+			|| !PositionString.IsNumeric())
+		{
+			return nullptr;
+		}
+		OutPosition = FCString::Atoi(*PositionString);
+
+		FScopeLock ScopeLock(&Lock);
+		RemoveExpired();
+		FEntry* Entry = Snapshots.Find(OutId);
+		if (!Entry || OutPosition < 0 || OutPosition > Entry->Items->Num())
+		{
+			return nullptr;
+		}
+		Entry->LastUsedTime = FPlatformTime::Seconds();
+		return Entry->Items;
+	}
+
+	/**
+	 * Token for the page starting at Position, or empty once the snapshot is exhausted.
+	 * An invalid Id stores the snapshot under a new one; an exhausted snapshot is released.
+	 */
+	FString Continue(FGuid& Id, const TSharedRef<const FSnapshot>& Items, int32 Position)
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Position >= Items->Num())
+		{
+			if (Id.IsValid())
+			{
+				Snapshots.Remove(Id);
+			}
+			return FString();
+		}
+
+		if (!Id.IsValid())
+		{
+			RemoveExpired();
+			if (Snapshots.Num() >= MaxSnapshots)
+			{
+				EvictOldest();
+			}
+			Id = FGuid::NewGuid();
+			Snapshots.Add(Id, { Items, FPlatformTime::Seconds() });
+		}
+		return FString::Printf(TEXT("%s:%d"), *Id.ToString(EGuidFormats::Digits), Position);
+	}
+
+private:
+	struct FEntry
+	{
+		TSharedRef<const FSnapshot> Items;
+		double LastUsedTime;
+	};
+
+	void RemoveExpired()
+	{
+		const double Cutoff = FPlatformTime::Seconds() - ExpirySeconds;
+		for (auto It = Snapshots.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastUsedTime < Cutoff)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	void EvictOldest()
+	{
+		const FGuid* Oldest = nullptr;
+		double OldestTime = TNumericLimits<double>::Max();
+		for (const TPair<FGuid, FEntry>& Pair : Snapshots)
+		{
+			if (Pair.Value.LastUsedTime < OldestTime)
+			{
+				Oldest = &Pair.Key;
+				OldestTime = Pair.Value.LastUsedTime;
+			}
+		}
+		if (Oldest)
+		{
+			Snapshots.Remove(FGuid(*Oldest));
+		}
+	}
+
+	FCriticalSection Lock;
+	TMap<FGuid, FEntry> Snapshots;
+};
@@ -0,0 +1,35 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Temporarily turns off the editor's "Use Less CPU when in Background" setting.
+ * While GRID IDE has focus the editor is a background window and ticks a few times a second,
+ * so queued bridge work would wait for those slow frames. The user's setting is restored once
+ * the bridge no longer needs it. Update() and Restore() run on the game thread; the queries
+ * may be read from any thread.
+ */
+class GRIDEDITOR_API FGRIDEditorThrottle
+{
+public:
+	~FGRIDEditorThrottle();
+
+	/** Lift the throttle while bKeepAwake is true, restore it once it turns false */
+	void Update(bool bKeepAwake);
+
+	/** Put the user's setting back if it was lifted */
+	void Restore();
+
+	bool IsLifted() const { return bLifted; }
+
+	/** Times the throttle was lifted, for bridge_stats */
+	int32 GetTimesLifted() const { return TimesLifted; }
+
+private:
+	std::atomic<bool> bLifted{false};
+	std::atomic<int32> TimesLifted{0};
+	bool bSavedThrottle = false;
+};
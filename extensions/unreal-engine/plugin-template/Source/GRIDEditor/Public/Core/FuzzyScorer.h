@@ -0,0 +1,37 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Quick-open style fuzzy matching of one query against many names.
+ * A name matches when every query character appears in it in order, ignoring case. Matches
+ * score more for consecutive characters, characters at word starts (after a separator, at a
+ * lower-to-upper case change or at a digit run) and whole-name or prefix matches, and less for
+ * gaps and for extra length. Names are described once by their lowercase form, a character
+ * mask and a word-start mask, so scoring allocates nothing.
+ */
+class GRIDEDITOR_API FGRIDFuzzyScorer
+{
+public:
+	explicit FGRIDFuzzyScorer(const FString& InQuery);
+
+	/** Bit set of the character classes in a lowercase string; a name lacking any of the query's cannot match */
+	static uint64 GetCharMask(const FString& LowerName);
+
+	/** Bit per word start among the first 64 characters of a name in its original case */
+	static uint64 GetWordStarts(const FString& Name);
+
+	/** Score of a name, or INDEX_NONE if it does not match; an empty query matches everything with 0 */
+	int32 Score(const FString& LowerName, uint64 CharMask, uint64 WordStarts) const;
+
+	bool IsEmpty() const { return Query.IsEmpty(); }
+
+private:
+	/** Whether Query[QueryIndex..] can still be matched in order from Name[From..] */
+	bool CanMatchRest(const TCHAR* Name, int32 NameLength, int32 QueryIndex, int32 From) const;
+
+	FString Query;
+	uint64 QueryMask;
+};
@@ -0,0 +1,112 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Dom/JsonObject.h"
+#include "Core/CancellationToken.h"
+
+/**
+ * Lifecycle of a background job.
+ */
+enum class EGRIDJobState : uint8
+{
+	Queued,
+	Running,
+	Succeeded,
+	Failed,
+	Cancelled
+};
+
+GRIDEDITOR_API const TCHAR* LexToString(EGRIDJobState State);
+
+/**
+ * A command run in the background for a client that asked for a job instead of a reply.
+ * Fields are read from any thread and written by the command, so access goes through the lock.
+ */
+class GRIDEDITOR_API FGRIDJob
+{
+public:
+	FGRIDJob(const FString& InId, const FString& InCommandType);
+
+	const FString& GetId() const { return Id; }
+	const FString& GetCommandType() const { return CommandType; }
+
+	/** Not tied to any request deadline; only job_cancel cancels it */
+	const TSharedRef<FGRIDCancellationToken>& GetCancellation() const { return Cancellation; }
+
+	EGRIDJobState GetState() const;
+	bool IsFinished() const;
+	double GetFinishedTime() const;
+
+	/** The command's response once finished; null before */
+	TSharedPtr<FJsonObject> GetResult() const;
+
+	void MarkRunning();
+	void SetProgress(float InFraction, const FString& InMessage);
+	void Finish(const TSharedPtr<FJsonObject>& InResult);
+
+	/** State, progress and timings, for job_status and job_list */
+	TSharedPtr<FJsonObject> ToJson() const;
+
+	/**
+	 * Report progress of the job running on this thread; does nothing outside a job, so handlers
+	 * may call it unconditionally. Fraction is clamped to [0, 1].
+	 */
+	static void ReportProgress(float Fraction, const FString& Message = FString());
+
+	/** Makes a job current on this thread while its command runs */
+	class GRIDEDITOR_API FScope
+	{
+	public:
+		explicit FScope(FGRIDJob* Job);
+		~FScope();
+
+	private:
+		FGRIDJob* Previous;
+	};
+
+private:
+	const FString Id;
+	const FString CommandType;
+	const TSharedRef<FGRIDCancellationToken> Cancellation;
+
+	mutable FCriticalSection Lock;
+	EGRIDJobState State = EGRIDJobState::Queued;
+	float Progress = 0.0f;
+	FString ProgressMessage;
+	TSharedPtr<FJsonObject> Result;
+	double CreatedTime;
+	double StartedTime = 0.0;
+	double FinishedTime = 0.0;
+};
+
+/**
+ * Jobs started by the bridge, by id. Finished jobs are kept for their results until they
+ * expire; the oldest finished jobs are evicted first when too many pile up. Thread-safe.
+ */
+class GRIDEDITOR_API FGRIDJobManager
+{
+public:
+	/** Finished jobs are forgotten this long after they finish */
+	static constexpr double RetentionSeconds = 600.0;
+
+	/** Finished jobs kept at once */
+	static constexpr int32 MaxFinishedJobs = 256;
+
+	TSharedRef<FGRIDJob> Create(const FString& CommandType);
+	TSharedPtr<FGRIDJob> Find(const FString& Id);
+
+	/** Every job still known, oldest first */
+	TArray<TSharedRef<FGRIDJob>> GetJobs();
+
+	/** Cancel every job; queued ones then finish as cancelled without running */
+	void CancelAll();
+
+private:
+	void RemoveExpired();
+
+	FCriticalSection Lock;
+	TMap<FString, TSharedRef<FGRIDJob>> Jobs;
+};
@@ -0,0 +1,71 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Dom/JsonObject.h"
+#include <atomic>
+
+struct FAssetData;
+class FPackageReloadedEvent;
+enum class EPackageReloadPhase : uint8;
+
+/**
+ * Assets loaded by bridge commands, by object path, so a run of commands on the same asset
+ * resolves it once. Entries are weak: the cache never keeps an asset alive, and one that was
+ * collected is simply loaded again. Entries are dropped when their package is reloaded and when
+ * the asset is renamed or deleted. Loads happen on the game thread; stats may be read anywhere.
+ */
+class GRIDEDITOR_API FGRIDObjectCache
+{
+public:
+	static FGRIDObjectCache& Get();
+
+	/** Start following package reload and asset rename/delete notifications; game thread */
+	void Start();
+
+	/** Stop following them and forget every entry; game thread */
+	void Stop();
+
+	/** The asset at Path (an object path, or a package path naming its main asset), loading it on a miss; null if it doesn't exist */
+	UObject* LoadAsset(const FString& Path);
+
+	template <typename ObjectType>
+	ObjectType* Load(const FString& Path)
+	{
+		return Cast<ObjectType>(LoadAsset(Path));
+	}
+
+	/** Drop every entry */
+	void Reset();
+
+	/** Entries, hits, misses and invalidations, for bridge_stats */
+	TSharedPtr<FJsonObject> ToJson() const;
+
+private:
+	/** Entries kept before collected ones are swept out */
+	static constexpr int32 MaxEntries = 4096;
+
+	/** Object path a command's path refers to; "/Game/A/B" names "/Game/A/B.B" */
+	static FString NormalizePath(const FString& Path);
+
+	void Invalidate(const FString& ObjectPath);
+
+	void OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event);
+	void OnAssetRemoved(const FAssetData& Asset);
+	void OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, TWeakObjectPtr<UObject>> Entries;
+
+	std::atomic<int64> Hits{0};
+	std::atomic<int64> Misses{0};
+	std::atomic<int64> Invalidations{0};
+
+	bool bStarted = false;
+	FDelegateHandle PackageReloadedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+};
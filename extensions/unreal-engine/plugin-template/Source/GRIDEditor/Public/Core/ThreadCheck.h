@@ -0,0 +1,35 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Assert that Site runs on the game thread, as check(IsInGameThread()) does. Inside an
+ * FGRIDThreadCheckScope on the calling thread, a call off the game thread is recorded in the
+ * scope instead of asserting.
+ */
+GRIDEDITOR_API void GRIDCheckGameThread(const TCHAR* Site);
+
+/**
+ * Collects the game-thread-only sites reached on the current thread while it is open, so a test
+ * can run thread-safe commands on a worker and report which paths they must not take.
+ */
+class GRIDEDITOR_API FGRIDThreadCheckScope
+{
+public:
+	FGRIDThreadCheckScope();
+	~FGRIDThreadCheckScope();
+
+	FGRIDThreadCheckScope(const FGRIDThreadCheckScope&) = delete;
+	FGRIDThreadCheckScope& operator=(const FGRIDThreadCheckScope&) = delete;
+
+	/** Sites passed to GRIDCheckGameThread() off the game thread, in call order */
+	const TArray<FString>& GetViolations() const { return Violations; }
+
+private:
+	friend void GRIDCheckGameThread(const TCHAR* Site);
+
+	FGRIDThreadCheckScope* Outer;
+	TArray<FString> Violations;
+};
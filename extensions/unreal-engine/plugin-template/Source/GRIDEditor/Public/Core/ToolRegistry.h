@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
 
 /**
  * Tool parameter metadata for AI tool definitions.
@@ -24,6 +25,32 @@ struct GRIDEDITOR_API FGRIDToolParameter
 	}
 };
 
+/**
+ * Thread a tool may run on.
+ */
+enum class EGRIDThreadAffinity : uint8
+{
+	/** Touches UObjects or editor state; runs on the game thread */
+	GameThread,
+	/** Reads only thread-safe state such as the Asset Registry; runs on a worker */
+	AnyThread
+};
+
+/**
+ * Scheduling lane a tool runs in.
+ */
+enum class EGRIDCommandPriority : uint8
+{
+	/** Quick queries and edits the user is waiting on; run ahead of bulk work */
+	Interactive,
+	/** Saves, compiles and imports that may take many frames */
+	Bulk
+};
+
+/** Parse "interactive" or "bulk"; returns false for anything else */
+GRIDEDITOR_API bool LexTryParseString(EGRIDCommandPriority& OutPriority, const TCHAR* Buffer);
+GRIDEDITOR_API const TCHAR* LexToString(EGRIDCommandPriority Priority);
+
 /**
  * Tool metadata for describing AI-accessible tools.
  */
@@ -34,6 +61,8 @@ struct GRIDEDITOR_API FGRIDToolMetadata
 	FString Category;
 	TArray<FString> Examples;
 	TArray<FGRIDToolParameter> Parameters;
+	EGRIDThreadAffinity ThreadAffinity = EGRIDThreadAffinity::GameThread;
+	EGRIDCommandPriority Priority = EGRIDCommandPriority::Interactive;
 
 	FGRIDToolMetadata() = default;
 };
@@ -50,10 +79,32 @@ struct GRIDEDITOR_API FGRIDToolRegistration
 	FString Category;
 	TArray<FGRIDToolParameter> Parameters;
 	FGRIDToolExecuteFunc ExecuteFunc;
+	EGRIDThreadAffinity ThreadAffinity = EGRIDThreadAffinity::GameThread;
+	EGRIDCommandPriority Priority = EGRIDCommandPriority::Interactive;
+};
+
+/** Handles one bridge command: takes its params and returns the response */
+using FGRIDCommandHandler = TFunction<TSharedPtr<FJsonObject>(const TSharedPtr<FJsonObject>&)>;
+
+/**
+ * A bridge command in the dispatch table.
+ */
+struct GRIDEDITOR_API FGRIDCommand
+{
+	/** The name as registered; FName keys ignore case, so lookups compare against this */
+	FString Name;
+	FGRIDCommandHandler Handler;
+	EGRIDThreadAffinity ThreadAffinity = EGRIDThreadAffinity::GameThread;
+	EGRIDCommandPriority Priority = EGRIDCommandPriority::Interactive;
+
+	/** Whoever registered the command; RemoveAll() drops its commands */
+	const void* Owner = nullptr;
 };
 
 /**
  * Tool registry for managing available AI tools.
+ * Also holds the bridge's command dispatch table, keyed by FName so a lookup hashes the
+ * command name once. It is filled when the bridge is created and read-only while it runs.
  */
 class GRIDEDITOR_API FGRIDToolRegistry
 {
@@ -68,7 +119,46 @@ public:
 	TArray<FGRIDToolMetadata> GetToolsByCategory(const FString& Category) const;
 	const FGRIDToolMetadata* FindTool(const FString& ToolName) const;
 
+	/** Where a tool must run; unregistered tools run on the game thread */
+	EGRIDThreadAffinity GetThreadAffinity(const FString& ToolName) const;
+
+	/** Lane a tool is scheduled in; unregistered tools are interactive */
+	EGRIDCommandPriority GetPriority(const FString& ToolName) const;
+
 	void RegisterTool(const FGRIDToolRegistration& Registration);
+
+	/** Register a bridge command along with its tool metadata */
+	void RegisterCommand(const FGRIDToolRegistration& Registration, FGRIDCommandHandler Handler, const void* Owner);
+
+	/** Register a bridge command handled by a member function of Owner */
+	template <typename OwnerType>
+	void RegisterCommand(OwnerType* Owner, const TCHAR* Name, TSharedPtr<FJsonObject> (OwnerType::*Method)(const TSharedPtr<FJsonObject>&),
+		const TCHAR* Category, const TCHAR* Description, EGRIDThreadAffinity ThreadAffinity = EGRIDThreadAffinity::GameThread,
+		TArray<FGRIDToolParameter> Parameters = {}, EGRIDCommandPriority Priority = EGRIDCommandPriority::Interactive)
+	{
+		FGRIDToolRegistration Registration;
+		Registration.Name = Name;
+		Registration.Description = Description;
+		Registration.Category = Category;
+		Registration.Parameters = MoveTemp(Parameters);
+		Registration.ThreadAffinity = ThreadAffinity;
+		Registration.Priority = Priority;
+		RegisterCommand(Registration, [Owner, Method](const TSharedPtr<FJsonObject>& Params) { return (Owner->*Method)(Params); }, Owner);
+	}
+
+	/** Register a game-thread bridge command in the given lane */
+	template <typename OwnerType>
+	void RegisterCommand(OwnerType* Owner, const TCHAR* Name, TSharedPtr<FJsonObject> (OwnerType::*Method)(const TSharedPtr<FJsonObject>&),
+		const TCHAR* Category, const TCHAR* Description, EGRIDCommandPriority Priority)
+	{
+		RegisterCommand(Owner, Name, Method, Category, Description, EGRIDThreadAffinity::GameThread, {}, Priority);
+	}
+
+	/** Find a bridge command by its exact, case-sensitive name; unknown names are never added to the name table */
+	const FGRIDCommand* FindCommand(const FString& CommandName) const;
+
+	/** Remove every command registered by Owner; call before Owner is destroyed */
+	void RemoveAll(const void* Owner);
 	bool IsToolEnabled(const FString& ToolName) const;
 	void SetToolEnabled(const FString& ToolName, bool bEnabled);
 
@@ -81,6 +171,7 @@ private:
 	TMap<FString, int32> ToolNameToIndex;
 	TMap<FString, FGRIDToolExecuteFunc> ToolExecuteFuncs;
 	TSet<FString> DisabledTools;
+	TMap<FName, FGRIDCommand> Commands;
 	bool bInitialized = false;
 };
 
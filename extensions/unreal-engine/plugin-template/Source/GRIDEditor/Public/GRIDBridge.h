@@ -4,10 +4,23 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Core/BridgeSettings.h"
+#include "Core/BridgeStats.h"
+#include "Core/CommandScheduler.h"
+#include "Core/CancellationToken.h"
+#include "Core/JobManager.h"
+#include "Core/EditorThrottle.h"
+#include <atomic>
+
+/** Receives a command's response; invoked on the game thread */
+using FGRIDCommandCallback = TFunction<void(const TSharedPtr<FJsonObject>&)>;
+
+/** Receives one page of a streamed result on the game thread; returning false abandons the stream */
+using FGRIDChunkCallback = TFunction<bool(const TSharedPtr<FJsonObject>&)>;
 
 /**
  * Bridge class that handles communication between GRID IDE and Unreal Editor.
- * Manages TCP server, command routing, and response handling.
+ * Manages TCP server (plus a Unix domain socket on Linux), command routing, and response handling.
  */
 class GRIDEDITOR_API FGRIDBridge
 {
@@ -21,8 +34,35 @@ public:
 	/** Shutdown the bridge and cleanup resources */
 	void Shutdown();
 
-	/** Execute a command and return the result */
-	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/**
+	 * Queue a command for the game thread, where it runs within the per-frame budget, or for a
+	 * worker if it is registered as thread-safe. OnComplete receives the response once it has run.
+	 * With "stream": true in Params and an OnChunk callback, a paginated command runs one page per
+	 * game-thread task: every page with a next_cursor goes to OnChunk and the last to OnComplete.
+	 * A command whose token is cancelled or expired by the time it would start is answered with
+	 * CANCELLED instead; while it runs the token is current, so handlers can stop between steps.
+	 * The command runs in the lane it was registered with unless Priority overrides it.
+	 */
+	void ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FGRIDCancellationToken>& Cancellation,
+		TOptional<EGRIDCommandPriority> Priority, FGRIDCommandCallback OnComplete, FGRIDChunkCallback OnChunk = nullptr);
+
+	/**
+	 * Queue a command as a background job and return its id at once. The job is not bound to the
+	 * request's deadline; clients follow it with job_status and fetch the response with job_result.
+	 */
+	TSharedPtr<FJsonObject> StartJob(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TOptional<EGRIDCommandPriority> Priority);
+
+	/** Create a standardized error response */
+	static TSharedPtr<FJsonObject> CreateErrorResponse(const FString& ErrorCode, const FString& ErrorMessage);
+
+	/**
+	 * BUSY error with a retry_after_ms hint: roughly how long the game thread needs to work
+	 * through Backlog commands at the rate it has managed so far
+	 */
+	TSharedPtr<FJsonObject> CreateBusyResponse(const FString& ErrorMessage, int32 Backlog) const;
+
+	/** Create a standardized success response */
+	static TSharedPtr<FJsonObject> CreateSuccessResponse(const TSharedPtr<FJsonObject>& Data = nullptr);
 
 	/** Check if the bridge is running */
 	bool IsRunning() const { return bIsRunning; }
@@ -30,22 +70,78 @@ public:
 	/** Get the port the server is listening on */
 	int32 GetPort() const { return Port; }
 
+	/** Get the Unix domain socket path, empty when not listening on one */
+	const FString& GetUnixSocketPath() const { return UnixSocketPath; }
+
+	/** Settings loaded from DefaultGRID.ini at initialization */
+	const FGRIDBridgeSettings& GetSettings() const { return Settings; }
+
+	/**
+	 * Liveness reply built on the calling thread without touching the game thread: how long ago the
+	 * scheduler last ticked and last finished a task, its queue depth, and whether PIE is running.
+	 */
+	TSharedPtr<FJsonObject> Heartbeat() const;
+
+	/** Connection and latency counters */
+	FGRIDBridgeStats& GetStats() { return Stats; }
+
 private:
-	/** Route command to appropriate handler */
+	/** Run a command through the dispatch table */
 	TSharedPtr<FJsonObject> RouteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
-	/** Create a standardized error response */
-	TSharedPtr<FJsonObject> CreateErrorResponse(const FString& ErrorCode, const FString& ErrorMessage);
+	/** Fill the dispatch table with the bridge's own commands and every command family's */
+	void RegisterCommands();
 
-	/** Create a standardized success response */
-	TSharedPtr<FJsonObject> CreateSuccessResponse(const TSharedPtr<FJsonObject>& Data);
+	// Bridge commands
+	TSharedPtr<FJsonObject> CheckConnection(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> GetBridgeStats(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> MakePayload(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> ListTools(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> GetJobStatus(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> GetJobResult(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> CancelJob(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> ListJobs(const TSharedPtr<FJsonObject>& Params);
+
+	/** Find the job named by a job_id param, or fill OutError */
+	TSharedPtr<FGRIDJob> FindJob(const TSharedPtr<FJsonObject>& Params, TSharedPtr<FJsonObject>& OutError);
+
+	/**
+	 * Count a command against MaxPendingCommands until the returned ticket is released; null when
+	 * the bridge is full. Tasks hold the ticket, so it is released however the command ends.
+	 */
+	TSharedPtr<void> TryAdmit();
+
+	/** Run a command's task on a worker if it is registered as thread-safe, otherwise on the game-thread scheduler */
+	void Dispatch(const FString& CommandType, EGRIDCommandPriority Priority, FGRIDCommandScheduler::FTask&& Task);
 
-	/** Write port file for GRID IDE discovery */
+	/** Registered lane of a command; a batch is bulk if any of its subcommands is */
+	EGRIDCommandPriority GetCommandPriority(const FString& CommandType, const TSharedPtr<FJsonObject>& Params) const;
+
+	/** Run every subcommand of a batch in order and collect their responses */
+	TSharedPtr<FJsonObject> RunBatch(const TSharedPtr<FJsonObject>& Params);
+
+	/** Run one page of a streamed command and queue the next while the result continues */
+	void RunStreamPage(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FGRIDCancellationToken>& Cancellation,
+		EGRIDCommandPriority Priority, FGRIDCommandCallback OnComplete, FGRIDChunkCallback OnChunk, double StartTime);
+
+	/** Answer a command whose token gave out before it could run; returns false if it should run */
+	bool DropIfCancelled(const FString& CommandType, const TSharedPtr<FGRIDCancellationToken>& Cancellation, const FGRIDCommandCallback& OnComplete);
+
+	/** Start the optional Unix domain socket listener */
+	void CreateUnixListener();
+
+	/** Write port file (and socket path file) for GRID IDE discovery */
 	void WritePortFile();
 
-	/** Delete port file on shutdown */
+	/** Delete port and socket path files on shutdown */
 	void DeletePortFile();
 
+	/** Per-frame editor bookkeeping: focus, and the background throttle while work is pending */
+	bool TickEditorState(float DeltaTime);
+
+	void OnBeginPIE(const bool bIsSimulating);
+	void OnEndPIE(const bool bIsSimulating);
+
 	// Command Handlers
 	TSharedPtr<class FBlueprintCommands> BlueprintCommands;
 	TSharedPtr<class FActorCommands> ActorCommands;
@@ -56,9 +152,41 @@ private:
 
 	// Server state
 	TSharedPtr<class FSocket> ListenerSocket;
+	TSharedPtr<class FSocket> UnixListenerSocket;
 	class FRunnableThread* ServerThread;
 	class FGRIDServerRunnable* ServerRunnable;
 	bool bIsRunning;
 	int32 Port;
 	FString PortFilePath;
+	FString UnixSocketPath;
+	FString SocketFilePath;
+
+	FGRIDBridgeSettings Settings;
+	FGRIDBridgeStats Stats;
+
+	/** Game-thread queue commands run from, unless they are thread-safe */
+	FGRIDCommandScheduler Scheduler;
+
+	/** Whether a Play In Editor session is running; set from editor delegates on the game thread */
+	std::atomic<bool> bPlayInEditor{false};
+	FDelegateHandle BeginPIEHandle;
+	FDelegateHandle EndPIEHandle;
+
+	/** Whether the editor window had focus at its last frame; latency is recorded per focus state */
+	std::atomic<bool> bEditorForeground{true};
+
+	FGRIDEditorThrottle Throttle;
+	FTSTicker::FDelegateHandle EditorStateTickerHandle;
+
+	/** Last frame a client was connected or work was pending; the throttle stays lifted shortly after */
+	double LastBusyTime = 0.0;
+
+	/** Background jobs started with "job": true */
+	FGRIDJobManager Jobs;
+
+	/** Commands admitted and not yet finished, across all connections */
+	FThreadSafeCounter PendingCommands;
+
+	/** Thread-safe commands still running on workers; awaited at shutdown */
+	FThreadSafeCounter ActiveWorkerCommands;
 };
@@ -0,0 +1,196 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Queue.h"
+#include "Core/CancellationToken.h"
+#include "Core/ToolRegistry.h"
+#include <atomic>
+
+class FSocket;
+class FGRIDSharedRing;
+
+/**
+ * Wire framing used on a client connection.
+ */
+enum class EGRIDFraming : uint8
+{
+	/** Bare JSON objects back to back, as sent by clients that predate framing */
+	Legacy,
+	/** Each message is preceded by its payload length as a 4-byte big-endian integer */
+	LengthPrefixed
+};
+
+/**
+ * Payload encoding used on a client connection.
+ */
+enum class EGRIDEncoding : uint8
+{
+	/** UTF-8 JSON text */
+	Json,
+	/** MessagePack; requires length-prefixed framing */
+	MessagePack
+};
+
+/**
+ * A message waiting to be written for a request.
+ */
+struct FGRIDOutbound
+{
+	TSharedPtr<FJsonObject> Message;
+
+	/** The response that completes the request; streamed chunks come before it */
+	bool bFinal = false;
+};
+
+/**
+ * A parsed request and its reply state.
+ * The reply is claimed exactly once, so a completion arriving after a timeout reply is dropped.
+ */
+struct FGRIDRequest
+{
+	FString CommandType;
+	TSharedPtr<FJsonObject> Params;
+
+	/** Echoed in the response; null for untagged requests from clients that predate ids */
+	TSharedPtr<FJsonValue> Id;
+
+	/** Set instead of a command when the request could not be parsed */
+	TSharedPtr<FJsonObject> ParseError;
+
+	/** Untagged requests and framing changes run alone so responses stay in order */
+	bool bExclusive = false;
+
+	/** Run as a background job: the reply carries a job id instead of the command's response */
+	bool bJob = false;
+
+	/** Lane requested by the client, overriding the command's registered one */
+	TOptional<EGRIDCommandPriority> Priority;
+
+	/** Seconds the request may take: the client's timeout_ms capped by RequestTimeoutSeconds; 0 for none */
+	double TimeoutSeconds = 0.0;
+
+	/** Deadline and cancel flag shared with the command; the deadline restarts whenever a chunk is streamed */
+	TSharedRef<FGRIDCancellationToken> Cancellation = MakeShared<FGRIDCancellationToken>();
+
+	/** Messages waiting to be written, in order; drained by one worker at a time */
+	TQueue<FGRIDOutbound, EQueueMode::Mpsc> Outbox;
+	std::atomic<bool> bDraining{false};
+
+	/** Set by the draining worker once the final response is written */
+	bool bFinished = false;
+
+	/** Returns true for the first caller only */
+	bool TryClaimReply() { return !bReplied.exchange(true); }
+	bool IsReplied() const { return bReplied.load(); }
+
+private:
+	std::atomic<bool> bReplied{false};
+};
+
+/**
+ * One client connection from GRID IDE.
+ * Reassembles messages from a reusable receive buffer and writes whole responses,
+ * handling partial sends. Responses may be sent from several threads; each is written
+ * atomically. The socket is owned by the caller.
+ */
+class FGRIDConnection
+{
+public:
+	/** Largest message accepted in either direction */
+	static constexpr int32 MaxMessageSize = 256 * 1024 * 1024;
+
+	explicit FGRIDConnection(FSocket* InSocket);
+	~FGRIDConnection();
+
+	FSocket* GetSocket() const { return Socket; }
+
+	EGRIDFraming GetFraming() const { return Framing; }
+	void SetFraming(EGRIDFraming InFraming) { Framing = InFraming; }
+
+	EGRIDEncoding GetEncoding() const { return Encoding; }
+	void SetEncoding(EGRIDEncoding InEncoding) { Encoding = InEncoding; }
+
+	/** Receive whatever is available into the buffer. Returns false once the peer has closed or the socket failed. */
+	bool ReceiveAvailable();
+
+	/**
+	 * Find the next complete message in the receive buffer.
+	 * The view stays valid until ConsumeMessage() or the next ReceiveAvailable().
+	 */
+	bool TryGetMessage(FUtf8StringView& OutMessage);
+
+	/** Drop the message last returned by TryGetMessage() */
+	void ConsumeMessage();
+
+	/** Decode a message with the connection's encoding; null if it is malformed */
+	TSharedPtr<FJsonObject> DecodeMessage(FUtf8StringView Message) const;
+
+	/** Set when the peer sent something that cannot be framed; the connection should be closed */
+	bool HasProtocolError() const { return bProtocolError; }
+
+	/**
+	 * Serialize a response with the current encoding and send it with the current framing.
+	 * With a bulk ring attached, large responses are written into it and only their location is sent.
+	 */
+	bool SendResponse(const TSharedPtr<FJsonObject>& Response);
+
+	/** Attach a shared-memory ring for bulk responses; call only while no response is being sent */
+	void SetBulkRing(TUniquePtr<FGRIDSharedRing> InRing, int64 InThreshold);
+
+	bool HasBulkRing() const { return BulkRing.IsValid(); }
+
+	/** Return a span of the bulk ring the client has finished reading */
+	bool ReleaseBulk(int64 Offset, int64 Length);
+
+	// Bookkeeping owned by the server thread
+	uint64 Key = 0;
+	double LastActivityTime = 0.0;
+	int32 RequestsServed = 0;
+	bool bPeerClosed = false;
+	TArray<TSharedPtr<FGRIDRequest>> InFlight;
+
+	/** Exclusive request parsed while others were still in flight */
+	TSharedPtr<FGRIDRequest> DeferredRequest;
+
+	/** Set by a worker when a response could not be written */
+	std::atomic<bool> bSendFailed{false};
+
+private:
+	bool TryGetLegacyMessage(FUtf8StringView& OutMessage);
+	bool TryGetFramedMessage(FUtf8StringView& OutMessage);
+
+	/** Write a message to an archive with the connection's encoding */
+	bool SerializeMessage(FArchive& Archive, const TSharedPtr<FJsonObject>& Message) const;
+
+	/** Serialize into the bulk ring; returns the message to send instead, or null to send Response itself */
+	TSharedPtr<FJsonObject> WriteBulk(const TSharedPtr<FJsonObject>& Response);
+
+	/** Send every byte, waiting for the socket to drain on partial writes */
+	bool SendAll(const uint8* Data, int32 Num);
+
+	FSocket* Socket;
+	EGRIDFraming Framing;
+	EGRIDEncoding Encoding;
+	bool bProtocolError;
+
+	// Receive buffer; bytes before ReadOffset have been consumed
+	TArray<uint8> RecvBuffer;
+	int32 ReadOffset;
+	int32 PendingMessageEnd;
+
+	// Incremental scan state for legacy (unframed) messages
+	int32 LegacyScanOffset;
+	int32 LegacyDepth;
+	bool bLegacyInString;
+	bool bLegacyEscape;
+
+	FCriticalSection SendLock;
+	TArray<uint8> SendBuffer;
+
+	TUniquePtr<FGRIDSharedRing> BulkRing;
+	int64 BulkThreshold;
+};
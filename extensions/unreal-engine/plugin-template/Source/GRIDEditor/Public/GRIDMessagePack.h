@@ -0,0 +1,21 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * MessagePack codec for the bridge's JSON object model.
+ * Integral numbers use the smallest integer encoding, other numbers float64, strings UTF-8.
+ * Decoding accepts every MessagePack type except extensions; binary blobs become strings.
+ */
+class GRIDEDITOR_API FGRIDMessagePack
+{
+public:
+	/** Append the encoding of Object to an archive */
+	static bool Write(FArchive& Archive, const TSharedPtr<FJsonObject>& Object);
+
+	/** Decode one map; returns null if Data is not exactly one well-formed MessagePack map */
+	static TSharedPtr<FJsonObject> Read(TConstArrayView<uint8> Data);
+};
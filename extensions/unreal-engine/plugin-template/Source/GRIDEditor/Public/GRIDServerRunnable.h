@@ -4,17 +4,29 @@
 
 #include "CoreMinimal.h"
 #include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Queue.h"
 
 class FGRIDBridge;
+class FGRIDConnection;
+class FGRIDSocketPoller;
+class FGRIDSharedRing;
+struct FGRIDRequest;
+struct FGRIDOutbound;
 class FSocket;
+class FJsonObject;
+class FQueuedThreadPool;
 
 /**
  * Server runnable that handles incoming connections from GRID IDE.
+ * One thread waits for readiness on the listeners (TCP, and a Unix domain socket on Linux)
+ * and every client socket. Requests tagged with an id are pipelined: each response is
+ * written by a worker as soon as its command finishes, so fast commands overtake slow ones.
  */
 class FGRIDServerRunnable : public FRunnable
 {
 public:
-	FGRIDServerRunnable(FGRIDBridge* InBridge, TSharedPtr<FSocket> InListenerSocket);
+	FGRIDServerRunnable(FGRIDBridge* InBridge, TArray<TSharedPtr<FSocket>> InListenerSockets);
 	virtual ~FGRIDServerRunnable();
 
 	// FRunnable interface
@@ -24,10 +36,83 @@ public:
 	virtual void Exit() override;
 
 private:
-	void HandleClientConnection(FSocket* ClientSocket);
-	FString ProcessRequest(const FString& RequestData);
+	/** Lets completions that arrive on the game thread after shutdown find the server gone */
+	struct FServerHandle
+	{
+		FCriticalSection Lock;
+		FGRIDServerRunnable* Server = nullptr;
+	};
+
+	/** Accept every pending connection on a listener, refusing those over the connection limit */
+	void AcceptConnections(FSocket* Listener);
+
+	/** Read newly arrived bytes from a readable client */
+	void ReadConnection(const TSharedPtr<FGRIDConnection>& Connection);
+
+	/** Dispatch buffered requests until an exclusive request has to wait for the others */
+	void PumpConnection(const TSharedPtr<FGRIDConnection>& Connection);
+
+	/** Start executing a request on the game thread */
+	void DispatchRequest(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request);
+
+	/** Hand a response to a worker for sending, unless the request was already answered. Any thread. */
+	void Reply(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, TSharedPtr<FJsonObject> Response);
+
+	/** Send part of a streamed result ahead of the final response. Returns false once the stream should stop. Any thread. */
+	bool SendChunk(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, const TSharedPtr<FJsonObject>& Chunk);
+
+	/** Queue a message for a request and make sure a worker is draining its outbox */
+	void Post(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, FGRIDOutbound&& Outbound);
+
+	/** Write one message on a worker; the final one also applies negotiated transport changes */
+	void SendOutbound(const TSharedPtr<FGRIDConnection>& Connection, const TSharedPtr<FGRIDRequest>& Request, const FGRIDOutbound& Outbound);
+
+	/** Handle a worker having sent the response to a request */
+	void CompleteRequest(uint64 Key, const TSharedPtr<FGRIDRequest>& Request);
+
+	void CloseConnection(uint64 Key);
+
+	/**
+	 * Answer requests past the timeout and close connections idle past theirs.
+	 * Returns seconds until the next deadline, or -1 if there is none.
+	 */
+	double ServiceTimeouts();
+
+	/** Parse one request in the connection's encoding. Failures are returned as a request carrying ParseError. */
+	TSharedPtr<FGRIDRequest> ParseRequest(const FGRIDConnection& Connection, FUtf8StringView RequestData) const;
+
+	/** Whether a response completes framing negotiation; adds the agreed framing to it */
+	bool NegotiateFraming(const FGRIDConnection& Connection, const FGRIDRequest& Request, const TSharedPtr<FJsonObject>& Response) const;
+
+	/** Whether a response switches the connection to MessagePack; adds the agreed encoding to it */
+	bool NegotiateEncoding(const FGRIDConnection& Connection, const FGRIDRequest& Request, const TSharedPtr<FJsonObject>& Response, bool bFramed) const;
+
+	/** Create the shared-memory ring a check_connection asked for and describe it in the response */
+	TUniquePtr<FGRIDSharedRing> OfferBulkRing(const FGRIDConnection& Connection, const FGRIDRequest& Request, const TSharedPtr<FJsonObject>& Response) const;
+
+	/** Handle cancel on the server thread: answer the target request with CANCELLED and cancel its token */
+	TSharedPtr<FJsonObject> CancelRequest(const TSharedPtr<FGRIDConnection>& Connection, const FGRIDRequest& Request);
+
+	/** Handle bulk_release on the server thread; it only touches transport state */
+	TSharedPtr<FJsonObject> ReleaseBulk(FGRIDConnection& Connection, const FGRIDRequest& Request) const;
 
 	FGRIDBridge* Bridge;
-	TSharedPtr<FSocket> ListenerSocket;
+
+	/** Listening sockets; each is watched under its index as the poller key */
+	TArray<TSharedPtr<FSocket>> ListenerSockets;
 	FThreadSafeCounter StopTaskCounter;
+
+	TUniquePtr<FGRIDSocketPoller> Poller;
+	TSharedRef<FServerHandle> Handle;
+
+	/** Worker threads that serialize and send responses */
+	FQueuedThreadPool* ConnectionPool;
+	FThreadSafeCounter ActiveSends;
+
+	/** Open connections keyed by poller key; only touched by the server thread */
+	TMap<uint64, TSharedPtr<FGRIDConnection>> Connections;
+	uint64 NextConnectionKey;
+
+	/** Requests whose response has been sent, posted by workers */
+	TQueue<TPair<uint64, TSharedPtr<FGRIDRequest>>, EQueueMode::Mpsc> CompletedRequests;
 };
@@ -0,0 +1,58 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformMemory.h"
+
+/**
+ * Named shared-memory region used as a ring buffer for bulk responses.
+ * Responses are serialized straight into the region and the client reads them from its own
+ * mapping; each written span stays reserved until the client releases it. Spans may be released
+ * in any order, but space is reclaimed oldest first.
+ */
+class FGRIDSharedRing
+{
+public:
+	FGRIDSharedRing();
+	~FGRIDSharedRing();
+
+	/** Create and map the region, owner-only on Linux and Mac; fails if Name is taken. On Linux it appears as /dev/shm/<Name>. */
+	bool Create(const FString& InName, int64 InSize);
+
+	const FString& GetName() const { return Name; }
+	int64 GetSize() const { return Size; }
+
+	/**
+	 * Reserve the largest contiguous free span for one write. Returns null when the ring is full.
+	 * Only one write may be open at a time; finish it with CommitWrite() or simply abandon it.
+	 */
+	uint8* BeginWrite(int64& OutOffset, int64& OutCapacity);
+
+	/** Keep the first Length bytes written at Offset until the client releases them */
+	void CommitWrite(int64 Offset, int64 Length);
+
+	/** Return a committed span; false if no such span is outstanding */
+	bool Release(int64 Offset, int64 Length);
+
+private:
+	struct FSpan
+	{
+		int64 Offset;
+		int64 Length;
+		bool bReleased;
+	};
+
+	FString Name;
+	int64 Size;
+	FPlatformMemory::FSharedMemoryRegion* Region;
+
+	FCriticalSection Lock;
+
+	/** Committed spans in write order; the first one marks the oldest byte still in use */
+	TArray<FSpan> Spans;
+
+	/** Where the next write after the newest span starts */
+	int64 Head;
+};
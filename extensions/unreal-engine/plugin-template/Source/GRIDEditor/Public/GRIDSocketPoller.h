@@ -0,0 +1,46 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSocket;
+class FInternetAddr;
+
+/**
+ * Waits for readability on a set of sockets in a single call.
+ * Linux uses epoll with an eventfd wakeup handle. Windows and Mac pass the native handles to
+ * WSAPoll or poll along with a loopback datagram socket that Wakeup() sends to, since WSAPoll
+ * only accepts sockets. Wakeup() interrupts a pending Wait() from any thread.
+ */
+class FGRIDSocketPoller
+{
+public:
+	FGRIDSocketPoller();
+	~FGRIDSocketPoller();
+
+	bool Init();
+
+	/** Watch a socket; Key is reported by Wait() while the socket is readable */
+	bool Add(FSocket* Socket, uint64 Key);
+	void Remove(FSocket* Socket);
+
+	/**
+	 * Block until a watched socket is readable, Wakeup() is called or the timeout passes.
+	 * A negative timeout waits indefinitely. Must be called from the thread that owns the poller.
+	 */
+	void Wait(TArray<uint64>& OutReadyKeys, double TimeoutSeconds);
+
+	/** Interrupt a pending or the next Wait() */
+	void Wakeup();
+
+private:
+#if PLATFORM_LINUX
+	int32 EpollFd;
+	int32 WakeupFd;
+#else
+	TMap<FSocket*, uint64> Sockets;
+	FSocket* WakeupSocket;
+	TSharedPtr<FInternetAddr> WakeupAddress;
+#endif
+};
@@ -0,0 +1,30 @@
+// Copyright 2025 GRID. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSocket;
+
+/**
+ * Unix domain socket listener for the bridge.
+ * Local clients skip the loopback TCP stack, and the socket file is only accessible
+ * to the editor's user. Only implemented on Linux; elsewhere IsSupported() is false.
+ */
+class FGRIDUnixSocket
+{
+public:
+	static bool IsSupported();
+
+	/** Socket path for this editor process, under $XDG_RUNTIME_DIR when set */
+	static FString GetDefaultPath();
+
+	/**
+	 * Create a non-blocking listener bound to SocketPath with owner-only permissions.
+	 * Returns null on failure. Destroy it through the socket subsystem like any other socket.
+	 */
+	static FSocket* CreateListener(const FString& SocketPath, int32 Backlog);
+
+	/** Remove the socket file left behind by a listener */
+	static void DeleteSocketFile(const FString& SocketPath);
+};
@@ -10,6 +10,8 @@ import * as path from 'node:path';
 import * as net from 'node:net';
 import { promisify } from 'node:util';
 import { exec } from 'node:child_process';
+import { performance } from 'node:perf_hooks';
+import * as messagePack from './messagePack';
 
 const execAsync = promisify(exec);
 
@@ -18,12 +20,312 @@ let unrealClient: net.Socket | null = null;
 let unrealOutputChannel: vscode.OutputChannel | null = null;
 let portWatcher: fsSync.FSWatcher | null = null;
 let currentPort: number = 0;
+let currentSocketPath: string | null = null;
+
+type BulkLocation = { offset: number; length: number };
+type BridgeResponse = {
+	id?: number;
+	success: boolean;
+	data?: Record<string, unknown>;
+	error?: string;
+	error_code?: string;
+	// With BUSY: how long the plugin expects to need before it can take more work
+	retry_after_ms?: number;
+	bulk?: BulkLocation;
+	partial?: boolean;
+};
+
+interface PendingCommand {
+	resolve: (response: BridgeResponse | null) => void;
+	settled: boolean;
+	// Pages of a streamed result received ahead of the final response
+	chunks: BridgeResponse[];
+	// Restart the timeout; every streamed page shows the command is still making progress
+	touch: () => void;
+}
+
+// Wire framing negotiated with the plugin during check_connection
+let framing: 'legacy' | 'length_prefixed' = 'legacy';
+// Payload encoding negotiated alongside framing; MessagePack needs length-prefixed framing
+let encoding: 'json' | 'msgpack' = 'json';
+let receiveBuffer: Buffer = Buffer.alloc(0);
+let handshake: Promise<void> | null = null;
+// Shared-memory ring the plugin writes large responses into (Linux only)
+let bulkRing: { fd: number; size: number } | null = null;
+// Requests are tagged with an id and replies may arrive in any order. Timed-out entries stay
+// until their late reply arrives, so untagged replies from older plugins still line up in order.
+const pendingCommands = new Map<number, PendingCommand>();
+let nextRequestId = 1;
+// How long a command may go without a response or streamed page; sent to the plugin as its deadline
+const COMMAND_TIMEOUT_MS = 10000;
+// Heartbeats are answered by the plugin's network thread, so a missing reply means the editor is gone;
+// a game thread that hasn't ticked for HEARTBEAT_BUSY_MS only means it is busy
+const HEARTBEAT_INTERVAL_MS = 5000;
+const HEARTBEAT_BUSY_MS = 2000;
+let heartbeatTimer: ReturnType<typeof setInterval> | null = null;
+let editorBusy = false;
+
+function resetConnectionState(): void {
+	stopHeartbeat();
+	framing = 'legacy';
+	encoding = 'json';
+	receiveBuffer = Buffer.alloc(0);
+	handshake = null;
+	if (bulkRing) {
+		fsSync.closeSync(bulkRing.fd);
+		bulkRing = null;
+	}
+	const abandoned = [...pendingCommands.values()];
+	pendingCommands.clear();
+	for (const pending of abandoned) {
+		if (!pending.settled) {
+			pending.settled = true;
+			pending.resolve(null);
+		}
+	}
+}
+
+function stopHeartbeat(): void {
+	if (heartbeatTimer) {
+		clearInterval(heartbeatTimer);
+		heartbeatTimer = null;
+	}
+	editorBusy = false;
+}
+
+/**
+ * Probe the plugin periodically. Only an unanswered heartbeat drops the connection; a busy game
+ * thread is reported and waited out. Plugins that predate heartbeats answer UNKNOWN_COMMAND,
+ * which still proves they are alive.
+ */
+function startHeartbeat(client: net.Socket, projectRoot: string): void {
+	stopHeartbeat();
+	let inFlight = false;
+	heartbeatTimer = setInterval(() => {
+		if (inFlight) {
+			return;
+		}
+		inFlight = true;
+		void sendCommand('heartbeat', {}).then(response => {
+			inFlight = false;
+			if (unrealClient !== client) {
+				return;
+			}
+			if (!response) {
+				unrealOutputChannel?.appendLine('[GRID] Unreal Editor stopped answering heartbeats; reconnecting');
+				client.destroy();
+				void connectToUnreal(projectRoot);
+				return;
+			}
+			const gameThread = response.data?.game_thread as { since_last_tick_ms?: number } | undefined;
+			const sinceLastTick = gameThread?.since_last_tick_ms ?? -1;
+			const busy = sinceLastTick > HEARTBEAT_BUSY_MS;
+			if (busy !== editorBusy) {
+				editorBusy = busy;
+				unrealOutputChannel?.appendLine(busy
+					? `[GRID] Unreal Editor is busy (no editor tick for ${sinceLastTick.toFixed(0)}ms); commands will wait`
+					: '[GRID] Unreal Editor is responsive again');
+			}
+		});
+	}, HEARTBEAT_INTERVAL_MS);
+}
+
+/**
+ * Find the end of the JSON object at the front of the buffer (legacy framing).
+ * Returns the index just past its closing brace, or -1 if it is incomplete.
+ */
+function findJsonObjectEnd(buffer: Buffer): number {
+	let depth = 0;
+	let inString = false;
+	let escape = false;
+	for (let i = 0; i < buffer.length; i++) {
+		const char = buffer[i];
+		if (inString) {
+			if (escape) {
+				escape = false;
+			} else if (char === 0x5c) {
+				escape = true;
+			} else if (char === 0x22) {
+				inString = false;
+			}
+			continue;
+		}
+		if (char === 0x22) {
+			inString = true;
+		} else if (char === 0x7b) {
+			depth++;
+		} else if (char === 0x7d && --depth === 0) {
+			return i + 1;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Continue a bare-JSON scan with the next chunk; true once the top-level object has closed.
+ */
+function scanJsonObjectEnd(chunk: Buffer, state: { depth: number; inString: boolean; escape: boolean }): boolean {
+	for (let i = 0; i < chunk.length; i++) {
+		const char = chunk[i];
+		if (state.inString) {
+			if (state.escape) {
+				state.escape = false;
+			} else if (char === 0x5c) {
+				state.escape = true;
+			} else if (char === 0x22) {
+				state.inString = false;
+			}
+			continue;
+		}
+		if (char === 0x22) {
+			state.inString = true;
+		} else if (char === 0x7b) {
+			state.depth++;
+		} else if (char === 0x7d && --state.depth === 0) {
+			return true;
+		}
+	}
+	return false;
+}
 
 /**
- * Connect to the Unreal Editor plugin via TCP.
- * The plugin writes its port to Saved/Config/GRID/Port.txt
+ * Take the next complete message off the receive buffer, or null if more bytes are needed.
  */
-async function connectToUnreal(projectRoot: string): Promise<void> {
+function takeMessage(): Buffer | null {
+	if (framing === 'length_prefixed') {
+		if (receiveBuffer.length < 4) {
+			return null;
+		}
+		const length = receiveBuffer.readUInt32BE(0);
+		if (receiveBuffer.length < 4 + length) {
+			return null;
+		}
+		const message = receiveBuffer.subarray(4, 4 + length);
+		receiveBuffer = receiveBuffer.subarray(4 + length);
+		return message;
+	}
+
+	const end = findJsonObjectEnd(receiveBuffer);
+	if (end < 0) {
+		return null;
+	}
+	const message = receiveBuffer.subarray(0, end);
+	receiveBuffer = receiveBuffer.subarray(end);
+	return message;
+}
+
+function decodeResponse(payload: Buffer): BridgeResponse | null {
+	try {
+		return (encoding === 'msgpack' ? messagePack.decode(payload) : JSON.parse(payload.toString('utf8'))) as BridgeResponse;
+	} catch {
+		console.log('[GRID-UE] Received malformed response');
+		return null;
+	}
+}
+
+function encodeMessage(message: Record<string, unknown>): Buffer {
+	const body = encoding === 'msgpack' ? messagePack.encode(message) : Buffer.from(JSON.stringify(message), 'utf8');
+	if (framing === 'legacy') {
+		return body;
+	}
+	const header = Buffer.alloc(4);
+	header.writeUInt32BE(body.length, 0);
+	return Buffer.concat([header, body]);
+}
+
+/**
+ * Open the ring described in the handshake reply. Its name lives under /dev/shm.
+ */
+function openBulkRing(description: unknown): void {
+	const ring = description as { name?: string; size?: number } | undefined;
+	if (!ring?.name || !ring.size) {
+		return;
+	}
+	try {
+		bulkRing = { fd: fsSync.openSync(path.join('/dev/shm', ring.name), 'r'), size: ring.size };
+	} catch (err) {
+		console.log(`[GRID-UE] Could not open shared memory ring: ${(err as Error).message}`);
+	}
+}
+
+/**
+ * Read a response the plugin wrote into the shared-memory ring, then hand the span back.
+ */
+function readBulkResponse(location: BulkLocation): BridgeResponse | null {
+	if (!bulkRing) {
+		return null;
+	}
+	const body = Buffer.allocUnsafe(location.length);
+	fsSync.readSync(bulkRing.fd, body, 0, location.length, location.offset);
+	void writeCommand('bulk_release', location);
+	return decodeResponse(body);
+}
+
+function onUnrealData(data: Buffer): void {
+	receiveBuffer = receiveBuffer.length === 0 ? data : Buffer.concat([receiveBuffer, data]);
+
+	let message: Buffer | null;
+	while ((message = takeMessage()) !== null) {
+		let response = decodeResponse(message);
+		unrealOutputChannel?.appendLine(`[UE] ${encoding === 'json' ? message.toString('utf8') : JSON.stringify(response)}`);
+
+		// Switch before reading further: everything after the handshake reply uses the agreed format
+		if (response?.data?.framing === 'length_prefixed') {
+			framing = 'length_prefixed';
+		}
+		if (response?.data?.encoding === 'msgpack') {
+			encoding = 'msgpack';
+		}
+		if (response?.data?.shared_memory && !bulkRing) {
+			openBulkRing(response.data.shared_memory);
+		}
+
+		// Large responses arrive as a location in the ring; the id stays on the socket message
+		const id = typeof response?.id === 'number' ? response.id : pendingCommands.keys().next().value;
+		if (response?.bulk) {
+			response = readBulkResponse(response.bulk);
+		}
+
+		// Plugins that predate request ids answer in order without echoing them
+		const pending = id !== undefined ? pendingCommands.get(id) : undefined;
+		if (response?.partial) {
+			if (pending && !pending.settled) {
+				pending.chunks.push(response);
+				pending.touch();
+			}
+			continue;
+		}
+		if (id !== undefined) {
+			pendingCommands.delete(id);
+		}
+		if (pending && !pending.settled) {
+			pending.settled = true;
+			pending.resolve(pending.chunks.length > 0 && response ? mergeChunks(pending.chunks, response) : response);
+		}
+	}
+}
+
+/**
+ * Read the plugin's Unix domain socket path, written next to Port.txt on Linux.
+ */
+async function readSocketPath(projectRoot: string): Promise<string | null> {
+	if (process.platform === 'win32') {
+		return null;
+	}
+	try {
+		const socketPath = (await fs.readFile(path.join(projectRoot, 'Saved', 'Config', 'GRID', 'Socket.txt'), 'utf8')).trim();
+		return socketPath.length > 0 ? socketPath : null;
+	} catch {
+		return null;
+	}
+}
+
+/**
+ * Connect to the Unreal Editor plugin.
+ * The plugin writes its port to Saved/Config/GRID/Port.txt and, when it also listens on a
+ * Unix domain socket, the socket path to Socket.txt. The socket is preferred; TCP is the fallback.
+ */
+async function connectToUnreal(projectRoot: string, preferUnixSocket: boolean = true): Promise<void> {
 	const portFilePath = path.join(projectRoot, 'Saved', 'Config', 'GRID', 'Port.txt');
 
 	try {
@@ -44,45 +346,72 @@ async function connectToUnreal(projectRoot: string): Promise<void> {
 			unrealClient.destroy();
 			unrealClient = null;
 		}
+		resetConnectionState();
 
+		const socketPath = preferUnixSocket ? await readSocketPath(projectRoot) : null;
 		currentPort = port;
-		console.log(`[GRID-UE] Connecting to Unreal Editor on port ${port}...`);
+		currentSocketPath = socketPath;
+		console.log(`[GRID-UE] Connecting to Unreal Editor on ${socketPath ?? `port ${port}`}...`);
 
 		if (!unrealOutputChannel) {
 			unrealOutputChannel = vscode.window.createOutputChannel('Unreal Engine');
 		}
 
-		unrealClient = new net.Socket();
+		const client = new net.Socket();
+		unrealClient = client;
+		let connected = false;
 
-		unrealClient.connect(port, '127.0.0.1', () => {
+		const onConnect = () => {
+			connected = true;
 			console.log('[GRID-UE] Connected to Unreal Editor');
 			unrealOutputChannel?.appendLine('[GRID] Connected to Unreal Editor');
 
-			// Send connection check
-			sendCommand('check_connection', {}).then(response => {
+			// Send connection check and ask for length-prefixed framing, MessagePack and, on Linux, a
+			// shared-memory ring for large responses; older plugins ignore all three and the connection
+			// stays on bare JSON. Other commands wait for the answer.
+			const handshakeParams = { framing: 'length_prefixed', encoding: 'msgpack', shared_memory: process.platform === 'linux' };
+			handshake = writeCommand('check_connection', handshakeParams).then(response => {
+				handshake = null;
+				startHeartbeat(client, projectRoot);
 				if (response?.success) {
 					vscode.window.showInformationMessage(
 						`GRID connected to Unreal Editor (v${String((response.data?.engine_version as string | number) ?? 'unknown')})`
 					);
 				}
-			}).catch(() => { });
-		});
+			});
+		};
 
-		unrealClient.on('data', (data) => {
-			const message = data.toString();
-			unrealOutputChannel?.appendLine(`[UE] ${message}`);
-		});
+		if (socketPath) {
+			client.connect(socketPath, onConnect);
+		} else {
+			client.connect(port, '127.0.0.1', onConnect);
+		}
 
-		unrealClient.on('close', () => {
+		client.on('data', onUnrealData);
+
+		client.on('close', () => {
 			console.log('[GRID-UE] Connection closed');
-			unrealClient = null;
-			currentPort = 0;
+			if (unrealClient === client) {
+				unrealClient = null;
+				currentPort = 0;
+				currentSocketPath = null;
+				resetConnectionState();
+			}
 		});
 
-		unrealClient.on('error', (err) => {
+		client.on('error', (err) => {
 			console.log(`[GRID-UE] Connection error: ${err.message}`);
-			unrealClient = null;
-			currentPort = 0;
+			if (unrealClient === client) {
+				unrealClient = null;
+				currentPort = 0;
+				currentSocketPath = null;
+				resetConnectionState();
+
+				// A stale or unreachable socket file falls back to TCP
+				if (socketPath && !connected) {
+					void connectToUnreal(projectRoot, false);
+				}
+			}
 		});
 
 	} catch {
@@ -91,39 +420,415 @@ async function connectToUnreal(projectRoot: string): Promise<void> {
 	}
 }
 
-/**
- * Send a command to Unreal Editor and wait for response
- */
-async function sendCommand(command: string, params: Record<string, unknown>): Promise<{ success: boolean; data?: Record<string, unknown>; error?: string } | null> {
+type CommandOptions = {
+	// Scheduling lane; overrides the one the command is registered with
+	priority?: 'interactive' | 'bulk';
+	// Start a background job; the reply carries data.job_id instead of the command's response
+	job?: boolean;
+};
+
+function writeCommand(command: string, params: Record<string, unknown>, options: CommandOptions = {}): Promise<BridgeResponse | null> {
 	return new Promise((resolve) => {
 		if (!unrealClient?.writable) {
 			resolve(null);
 			return;
 		}
 
-		const request = JSON.stringify({ command, params });
+		// Time out without a response or streamed page, and tell the plugin to stop working on it
+		let timer: ReturnType<typeof setTimeout> | undefined;
+		const touch = () => {
+			clearTimeout(timer);
+			timer = setTimeout(() => {
+				if (!pending.settled) {
+					pending.settled = true;
+					resolve(null);
+					if (command !== 'cancel' && command !== 'bulk_release') {
+						void writeCommand('cancel', { request_id: id });
+					}
+				}
+			}, COMMAND_TIMEOUT_MS);
+		};
+
+		const id = nextRequestId++;
+		const pending: PendingCommand = {
+			resolve: (response) => {
+				clearTimeout(timer);
+				resolve(response);
+			},
+			settled: false,
+			chunks: [],
+			touch
+		};
+		pendingCommands.set(id, pending);
+		unrealClient.write(encodeMessage({ id, command, params, timeout_ms: COMMAND_TIMEOUT_MS, ...options }));
+		touch();
+	});
+}
+
+/**
+ * Join the pages of a streamed result into one response.
+ * Array fields are concatenated in order and count is summed; other fields come from the final page.
+ */
+function mergeChunks(chunks: BridgeResponse[], final: BridgeResponse): BridgeResponse {
+	if (!final.success || !final.data) {
+		return final;
+	}
+	const data: Record<string, unknown> = { ...final.data };
+	for (const [key, value] of Object.entries(final.data)) {
+		if (Array.isArray(value)) {
+			data[key] = chunks.flatMap(chunk => (chunk.data?.[key] as unknown[] | undefined) ?? []).concat(value);
+		}
+	}
+	if (typeof data.count === 'number') {
+		data.count = chunks.reduce((count, chunk) => count + ((chunk.data?.count as number | undefined) ?? 0), data.count);
+	}
+	return { ...final, partial: undefined, data };
+}
+
+// Times a command refused with BUSY is retried after the plugin's retry_after_ms hint
+const BUSY_RETRIES = 3;
+
+/**
+ * Send a command to Unreal Editor and wait for its response.
+ * Calls do not wait for each other; the plugin answers each as soon as it finishes.
+ */
+async function sendCommand(command: string, params: Record<string, unknown>, options: CommandOptions = {}): Promise<BridgeResponse | null> {
+	if (handshake) {
+		await handshake;
+	}
+	for (let attempt = 0; ; attempt++) {
+		const response = await writeCommand(command, params, options);
+		if (response?.error_code !== 'BUSY' || attempt >= BUSY_RETRIES) {
+			return response;
+		}
+		await new Promise(resolve => setTimeout(resolve, response.retry_after_ms ?? 100));
+	}
+}
+
+/**
+ * Run a command as a background job: start it, poll job_status until it finishes, then fetch
+ * its response. No request stays open while it runs, so it is not subject to the command timeout.
+ */
+async function runJob(command: string, params: Record<string, unknown>, onProgress?: (progress: number, message?: string) => void): Promise<BridgeResponse | null> {
+	const started = await sendCommand(command, params, { job: true });
+	const jobId = started?.success ? started.data?.job_id : undefined;
+	if (typeof jobId !== 'string') {
+		return started;
+	}
+
+	for (;;) {
+		const status = await sendCommand('job_status', { job_id: jobId });
+		if (!status?.success) {
+			return status;
+		}
+		const state = status.data?.state;
+		onProgress?.(status.data?.progress as number, status.data?.message as string | undefined);
+		if (state !== 'queued' && state !== 'running') {
+			return sendCommand('job_result', { job_id: jobId });
+		}
+		await new Promise(resolve => setTimeout(resolve, 250));
+	}
+}
+
+/**
+ * Send one command on a fresh connection, closing it after the reply.
+ * This is how every call behaved before the plugin kept connections alive.
+ */
+function sendCommandOnNewConnection(target: net.NetConnectOpts, command: string, params: Record<string, unknown>): Promise<boolean> {
+	return new Promise((resolve) => {
+		const socket = net.createConnection(target, () => {
+			socket.write(JSON.stringify({ command, params }));
+		});
 		let responseData = '';
 
-		const onData = (data: Buffer) => {
+		socket.on('data', (data) => {
 			responseData += data.toString();
 			try {
-				const response = JSON.parse(responseData) as { success: boolean; data?: Record<string, unknown>; error?: string };
-				unrealClient?.off('data', onData);
-				resolve(response);
+				JSON.parse(responseData);
+				socket.destroy();
+				resolve(true);
 			} catch {
 				// Incomplete JSON, wait for more data
 			}
-		};
+		});
+		socket.on('error', () => resolve(false));
+		socket.setTimeout(10000, () => {
+			socket.destroy();
+			resolve(false);
+		});
+	});
+}
+
+/**
+ * Time sequential round trips of one command over a dedicated connection that bypasses the
+ * shared-memory ring, so every response crosses the socket.
+ */
+async function measureTransport(target: net.NetConnectOpts, iterations: number, command: string, params: Record<string, unknown>): Promise<number[]> {
+	const socket = net.createConnection(target);
+	try {
+		await new Promise<void>((resolve, reject) => {
+			socket.once('connect', resolve);
+			socket.once('error', reject);
+		});
+	} catch {
+		socket.destroy();
+		return [];
+	}
 
-		unrealClient.on('data', onData);
-		unrealClient.write(request);
+	// Collect chunks instead of concatenating per read, and scan bare JSON as it arrives, so
+	// multi-megabyte replies stay linear
+	const chunks: Buffer[] = [];
+	let received = 0;
+	let expected = -1;
+	let framed = false;
+	const scan = { depth: 0, inString: false, escape: false };
+	let waiting: ((ok: boolean) => void) | null = null;
+	const finish = (ok: boolean) => {
+		const done = waiting;
+		waiting = null;
+		done?.(ok);
+	};
+	socket.on('data', (data) => {
+		chunks.push(data);
+		received += data.length;
+		let ok = true;
+		if (!framed) {
+			if (!scanJsonObjectEnd(data, scan)) {
+				return;
+			}
+		} else {
+			if (expected < 0 && received >= 4) {
+				expected = 4 + Buffer.concat(chunks).readUInt32BE(0);
+			}
+			if (expected < 0 || received < expected) {
+				return;
+			}
+			try {
+				JSON.parse(Buffer.concat(chunks).toString('utf8', 4));
+			} catch {
+				ok = false;
+			}
+		}
+		chunks.length = 0;
+		received = 0;
+		expected = -1;
+		scan.depth = 0;
+		scan.inString = false;
+		scan.escape = false;
+		finish(ok);
+	});
+	socket.on('error', () => finish(false));
+	socket.on('close', () => finish(false));
 
-		// Timeout after 10 seconds
-		setTimeout(() => {
-			unrealClient?.off('data', onData);
-			resolve(null);
-		}, 10000);
+	const roundTrip = (message: Buffer) => new Promise<boolean>((resolve) => {
+		waiting = resolve;
+		socket.write(message);
 	});
+
+	try {
+		if (!await roundTrip(Buffer.from(JSON.stringify({ command: 'check_connection', params: { framing: 'length_prefixed' } })))) {
+			return [];
+		}
+		framed = true;
+
+		const body = Buffer.from(JSON.stringify({ command, params }));
+		const header = Buffer.alloc(4);
+		header.writeUInt32BE(body.length, 0);
+		const request = Buffer.concat([header, body]);
+		return await measureLatency(iterations, () => roundTrip(request));
+	} finally {
+		socket.destroy();
+	}
+}
+
+async function measureLatency(iterations: number, run: () => Promise<boolean>): Promise<number[]> {
+	const samples: number[] = [];
+	for (let i = 0; i < iterations; i++) {
+		const start = performance.now();
+		if (await run()) {
+			samples.push(performance.now() - start);
+		}
+	}
+	return samples;
+}
+
+function formatLatency(label: string, samples: number[]): string {
+	if (samples.length === 0) {
+		return `${label}: no successful samples`;
+	}
+	const sorted = [...samples].sort((a, b) => a - b);
+	const percentile = (p: number) => sorted[Math.min(sorted.length - 1, Math.floor(p * sorted.length))];
+	const avg = sorted.reduce((sum, value) => sum + value, 0) / sorted.length;
+	return `${label}: n=${sorted.length} avg=${avg.toFixed(3)}ms p50=${percentile(0.5).toFixed(3)}ms p95=${percentile(0.95).toFixed(3)}ms`;
+}
+
+function averageMs(iterations: number, run: () => void): number {
+	const start = performance.now();
+	for (let i = 0; i < iterations; i++) {
+		run();
+	}
+	return (performance.now() - start) / iterations;
+}
+
+/**
+ * Compare JSON and MessagePack size and encode/decode time on an actor_list response.
+ * Levels smaller than the target are padded with synthetic actors of the same shape.
+ */
+function benchmarkEncoding(actorList: BridgeResponse | null, actorCount: number): string[] {
+	const source = (actorList?.data?.actors as Record<string, unknown>[] | undefined) ?? [];
+	const actors = source.length >= actorCount ? source : Array.from({ length: actorCount }, (_, i) => ({
+		name: `StaticMeshActor_${i}`,
+		class: 'StaticMeshActor',
+		x: ((i * 7919) % 200000) - 100000 + 0.25,
+		y: ((i * 104729) % 200000) - 100000 + 0.5,
+		z: (i % 5000) + 0.125,
+	}));
+	const response = { success: true, data: { actors, count: actors.length } };
+
+	const iterations = 5;
+	let json = '';
+	let packed = Buffer.alloc(0);
+	const jsonEncode = averageMs(iterations, () => { json = JSON.stringify(response); });
+	const jsonDecode = averageMs(iterations, () => JSON.parse(json));
+	const packEncode = averageMs(iterations, () => { packed = messagePack.encode(response); });
+	const packDecode = averageMs(iterations, () => messagePack.decode(packed));
+
+	return [
+		`[GRID] Encoding benchmark (actor_list, ${actors.length} actors, ${source.length} from the open level)`,
+		`[GRID]   json:    ${Buffer.byteLength(json)} bytes, encode ${jsonEncode.toFixed(2)}ms, decode ${jsonDecode.toFixed(2)}ms`,
+		`[GRID]   msgpack: ${packed.length} bytes, encode ${packEncode.toFixed(2)}ms, decode ${packDecode.toFixed(2)}ms`,
+		`[GRID]   connection encoding: ${encoding}; run GRID.Bench.Encoding in the editor console for server-side timings`,
+	];
+}
+
+/**
+ * Measure per-command round-trip latency against the running editor.
+ */
+async function benchmarkBridge(): Promise<void> {
+	if (!unrealClient?.writable || currentPort === 0) {
+		await vscode.window.showErrorMessage('Not connected to Unreal Editor');
+		return;
+	}
+
+	if (!unrealOutputChannel) {
+		unrealOutputChannel = vscode.window.createOutputChannel('Unreal Engine');
+	}
+	unrealOutputChannel.show();
+
+	const iterations = 200;
+	const tcp: net.NetConnectOpts = { port: currentPort, host: '127.0.0.1' };
+	const unixSocket: net.NetConnectOpts | null = currentSocketPath ? { path: currentSocketPath } : null;
+	const keepAlive = await measureLatency(iterations, async () => (await sendCommand('check_connection', {})) !== null);
+	const heartbeat = await measureLatency(iterations, async () => (await sendCommand('heartbeat', {}))?.success === true);
+	const reconnect = await measureLatency(iterations, () => sendCommandOnNewConnection(tcp, 'check_connection', {}));
+	const tcpTransport = await measureTransport(tcp, iterations, 'check_connection', {});
+	const unixTransport = unixSocket ? await measureTransport(unixSocket, iterations, 'check_connection', {}) : [];
+
+	// Multi-megabyte responses through the socket versus the shared-memory ring. bridge_payload
+	// is only registered when the editor enables benchmark commands
+	const bulkIterations = 20;
+	const bulkParams = { size: 8 * 1024 * 1024 };
+	const bulkAvailable = (await sendCommand('bridge_payload', { size: 0 }))?.success === true;
+	const bulkOverSocket = bulkAvailable ? await measureTransport(unixSocket ?? tcp, bulkIterations, 'bridge_payload', bulkParams) : [];
+	const bulkOverRing = bulkAvailable && bulkRing
+		? await measureLatency(bulkIterations, async () => (await sendCommand('bridge_payload', bulkParams))?.success === true)
+		: [];
+
+	// The whole level in one response versus streamed pages
+	const listIterations = 5;
+	const listWhole = await measureLatency(listIterations, async () => (await sendCommand('actor_list', {}))?.success === true);
+	const listStreamed = await measureLatency(listIterations, async () => (await sendCommand('actor_list', { stream: true }))?.success === true);
+
+	// One command per round trip versus the same commands in a single batch
+	const batchSize = 200;
+	const sequentialStart = performance.now();
+	for (let i = 0; i < batchSize; i++) {
+		await sendCommand('check_connection', {});
+	}
+	const sequentialMs = performance.now() - sequentialStart;
+	const batchStart = performance.now();
+	const batch = await sendCommand('batch', { commands: Array.from({ length: batchSize }, () => ({ command: 'check_connection' })) });
+	const batchMs = performance.now() - batchStart;
+
+	// Small game-thread queries while bulk batches are queued: in the interactive lane versus
+	// sharing the bulk lane, as every command did before lanes existed
+	const probeIterations = 20;
+	const probe = (priority: 'interactive' | 'bulk') => measureLatency(probeIterations, async () =>
+		(await sendCommand('actor_list', { limit: 1 }, { priority }))?.success === true);
+	const measureUnderLoad = async (priority: 'interactive' | 'bulk') => {
+		const load = Array.from({ length: 8 }, () => sendCommand('batch',
+			{ commands: Array.from({ length: 20 }, () => ({ command: 'actor_list', params: { limit: 200 } })) }, { priority: 'bulk' }));
+		const samples = await probe(priority);
+		await Promise.all(load);
+		return samples;
+	};
+	const probeIdle = await probe('interactive');
+	const probeInteractiveLane = await measureUnderLoad('interactive');
+	const probeSharedLane = await measureUnderLoad('bulk');
+
+	// The same batch as a background job, polled to completion
+	const jobStart = performance.now();
+	const job = await runJob('batch', { commands: Array.from({ length: batchSize }, () => ({ command: 'check_connection' })) });
+	const jobMs = performance.now() - jobStart;
+
+	// Issue every request up front and wait for all replies
+	const pipelineStart = performance.now();
+	const pipelined = await Promise.all(Array.from({ length: iterations }, () => sendCommand('check_connection', {})));
+	const pipelineMs = performance.now() - pipelineStart;
+	const pipelinedOk = pipelined.filter(response => response !== null).length;
+
+	unrealOutputChannel.appendLine('[GRID] Bridge latency benchmark (check_connection)');
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('keep-alive connection', keepAlive)}`);
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('heartbeat (server thread)', heartbeat)}`);
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('connection per command', reconnect)}`);
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('tcp loopback', tcpTransport)}`);
+	unrealOutputChannel.appendLine(unixSocket
+		? `[GRID]   ${formatLatency('unix socket', unixTransport)}`
+		: '[GRID]   unix socket: not offered by the plugin');
+	unrealOutputChannel.appendLine('[GRID] Bulk transfer benchmark (bridge_payload, 8 MiB)');
+	if (!bulkAvailable) {
+		unrealOutputChannel.appendLine('[GRID]   skipped: set bEnableBenchmarkCommands=true in DefaultGRID.ini');
+	} else {
+		unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('socket', bulkOverSocket)}`);
+		unrealOutputChannel.appendLine(bulkRing
+			? `[GRID]   ${formatLatency('shared memory ring', bulkOverRing)}`
+			: '[GRID]   shared memory ring: not negotiated');
+	}
+	unrealOutputChannel.appendLine('[GRID] Listing benchmark (actor_list)');
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('single response', listWhole)}`);
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('streamed pages', listStreamed)}`);
+	unrealOutputChannel.appendLine(`[GRID] Batch benchmark (${batchSize} x check_connection)`);
+	unrealOutputChannel.appendLine(`[GRID]   one per round trip: ${sequentialMs.toFixed(3)}ms (${(batchSize * 1000 / sequentialMs).toFixed(0)} calls/s)`);
+	unrealOutputChannel.appendLine(batch?.success
+		? `[GRID]   single batch: ${batchMs.toFixed(3)}ms (${(batchSize * 1000 / batchMs).toFixed(0)} calls/s)`
+		: '[GRID]   single batch: not supported by the plugin');
+	unrealOutputChannel.appendLine(job?.success
+		? `[GRID]   background job: ${jobMs.toFixed(3)}ms including polling`
+		: '[GRID]   background job: not supported by the plugin');
+	unrealOutputChannel.appendLine(`[GRID]   pipelined: ${pipelinedOk}/${iterations} replies in ${pipelineMs.toFixed(3)}ms (${(pipelineMs / iterations).toFixed(3)}ms per command)`);
+	unrealOutputChannel.appendLine('[GRID] Mixed traffic benchmark (actor_list limit 1 behind 8 bulk batches)');
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('idle', probeIdle)}`);
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('interactive lane', probeInteractiveLane)}`);
+	unrealOutputChannel.appendLine(`[GRID]   ${formatLatency('same lane as bulk', probeSharedLane)}`);
+
+	for (const line of benchmarkEncoding(await sendCommand('actor_list', {}), 50000)) {
+		unrealOutputChannel.appendLine(line);
+	}
+
+	const stats = await sendCommand('bridge_stats', {});
+	if (stats?.success) {
+		// The IDE has focus while this runs, so the editor is in the background: with the throttle
+		// lifted, game-thread commands should cost about the same as when the editor has focus
+		const latency = (key: string) => stats.data?.[key] as { count: number; avg_ms: number; max_ms: number } | undefined;
+		const formatServerLatency = (label: string, value?: { count: number; avg_ms: number; max_ms: number }) => value && value.count > 0
+			? `${label}: n=${value.count} avg=${value.avg_ms.toFixed(3)}ms max=${value.max_ms.toFixed(3)}ms`
+			: `${label}: no commands recorded`;
+		const throttle = stats.data?.background_throttle as { enabled?: boolean; lifted?: boolean } | undefined;
+		unrealOutputChannel.appendLine(`[GRID] Focus benchmark (server-side latency; background throttle ${throttle?.enabled ? 'lifted while connected' : 'left on'})`);
+		unrealOutputChannel.appendLine(`[GRID]   ${formatServerLatency('editor in foreground', latency('latency_foreground'))}`);
+		unrealOutputChannel.appendLine(`[GRID]   ${formatServerLatency('editor in background', latency('latency_background'))}`);
+		unrealOutputChannel.appendLine(`[GRID]   server stats: ${JSON.stringify(stats.data)}`);
+	}
 }
 
 /**
@@ -176,6 +881,9 @@ export function activate(context: vscode.ExtensionContext): void {
 		}),
 		vscode.commands.registerCommand('unrealEngine.buildEditor', () => {
 			void buildEditor();
+		}),
+		vscode.commands.registerCommand('unrealEngine.benchmarkBridge', () => {
+			void benchmarkBridge();
 		})
 	);
 
@@ -588,6 +1296,7 @@ export function deactivate(): void {
 	console.log('Unreal Engine extension deactivated');
 
 	// Clean up Unreal connection
+	stopHeartbeat();
 	if (unrealClient) {
 		unrealClient.destroy();
 		unrealClient = null;
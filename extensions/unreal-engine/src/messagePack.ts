@@ -0,0 +1,248 @@
+/*---------------------------------------------------------------------------------------------
+ *  Copyright (c) Microsoft Corporation. All rights reserved.
+ *  Licensed under the MIT License. See License.txt in the project root for license information.
+ *--------------------------------------------------------------------------------------------*/
+
+/**
+ * MessagePack codec matching the editor plugin's FGRIDMessagePack.
+ * Integers use the smallest integer encoding, other numbers float64, strings UTF-8.
+ * Decoding accepts every type except extensions; binary blobs become strings.
+ */
+
+class Writer {
+	private buffer = Buffer.allocUnsafe(1024);
+	private length = 0;
+
+	finish(): Buffer {
+		return this.buffer.subarray(0, this.length);
+	}
+
+	value(value: unknown): void {
+		if (value === null || value === undefined) {
+			this.byte(0xc0);
+		} else if (typeof value === 'boolean') {
+			this.byte(value ? 0xc3 : 0xc2);
+		} else if (typeof value === 'number') {
+			this.number(value);
+		} else if (typeof value === 'string') {
+			this.string(value);
+		} else if (Array.isArray(value)) {
+			this.header(value.length, 0x90, 16, 0xdc);
+			for (const element of value) {
+				this.value(element);
+			}
+		} else if (typeof value === 'object') {
+			const entries = Object.entries(value as Record<string, unknown>).filter(([, field]) => field !== undefined);
+			this.header(entries.length, 0x80, 16, 0xde);
+			for (const [key, field] of entries) {
+				this.string(key);
+				this.value(field);
+			}
+		} else {
+			this.byte(0xc0);
+		}
+	}
+
+	private number(value: number): void {
+		if (Number.isSafeInteger(value)) {
+			if (value >= 0) {
+				if (value < 128) {
+					this.byte(value);
+				} else if (value <= 0xff) {
+					this.byte(0xcc);
+					this.byte(value);
+				} else if (value <= 0xffff) {
+					this.reserve(3);
+					this.buffer[this.length++] = 0xcd;
+					this.length = this.buffer.writeUInt16BE(value, this.length);
+				} else if (value <= 0xffffffff) {
+					this.reserve(5);
+					this.buffer[this.length++] = 0xce;
+					this.length = this.buffer.writeUInt32BE(value, this.length);
+				} else {
+					this.reserve(9);
+					this.buffer[this.length++] = 0xcf;
+					this.length = this.buffer.writeBigUInt64BE(BigInt(value), this.length);
+				}
+			} else if (value >= -32) {
+				this.byte(value & 0xff);
+			} else if (value >= -0x80) {
+				this.reserve(2);
+				this.buffer[this.length++] = 0xd0;
+				this.length = this.buffer.writeInt8(value, this.length);
+			} else if (value >= -0x8000) {
+				this.reserve(3);
+				this.buffer[this.length++] = 0xd1;
+				this.length = this.buffer.writeInt16BE(value, this.length);
+			} else if (value >= -0x80000000) {
+				this.reserve(5);
+				this.buffer[this.length++] = 0xd2;
+				this.length = this.buffer.writeInt32BE(value, this.length);
+			} else {
+				this.reserve(9);
+				this.buffer[this.length++] = 0xd3;
+				this.length = this.buffer.writeBigInt64BE(BigInt(value), this.length);
+			}
+			return;
+		}
+		this.reserve(9);
+		this.buffer[this.length++] = 0xcb;
+		this.length = this.buffer.writeDoubleBE(value, this.length);
+	}
+
+	private string(value: string): void {
+		const size = Buffer.byteLength(value, 'utf8');
+		if (size < 32) {
+			this.byte(0xa0 | size);
+		} else if (size <= 0xff) {
+			this.byte(0xd9);
+			this.byte(size);
+		} else if (size <= 0xffff) {
+			this.reserve(3);
+			this.buffer[this.length++] = 0xda;
+			this.length = this.buffer.writeUInt16BE(size, this.length);
+		} else {
+			this.reserve(5);
+			this.buffer[this.length++] = 0xdb;
+			this.length = this.buffer.writeUInt32BE(size, this.length);
+		}
+		this.reserve(size);
+		this.length += this.buffer.write(value, this.length, 'utf8');
+	}
+
+	private header(count: number, fixPrefix: number, fixLimit: number, prefix16: number): void {
+		if (count < fixLimit) {
+			this.byte(fixPrefix | count);
+		} else if (count <= 0xffff) {
+			this.reserve(3);
+			this.buffer[this.length++] = prefix16;
+			this.length = this.buffer.writeUInt16BE(count, this.length);
+		} else {
+			this.reserve(5);
+			this.buffer[this.length++] = prefix16 + 1;
+			this.length = this.buffer.writeUInt32BE(count, this.length);
+		}
+	}
+
+	private byte(value: number): void {
+		this.reserve(1);
+		this.buffer[this.length++] = value;
+	}
+
+	private reserve(size: number): void {
+		if (this.length + size <= this.buffer.length) {
+			return;
+		}
+		const grown = Buffer.allocUnsafe(Math.max(this.buffer.length * 2, this.length + size));
+		this.buffer.copy(grown, 0, 0, this.length);
+		this.buffer = grown;
+	}
+}
+
+class Reader {
+	private offset = 0;
+
+	constructor(private readonly buffer: Buffer) { }
+
+	get atEnd(): boolean {
+		return this.offset === this.buffer.length;
+	}
+
+	value(): unknown {
+		const byte = this.uint(1);
+		if (byte <= 0x7f) {
+			return byte;
+		}
+		if (byte >= 0xe0) {
+			return byte - 0x100;
+		}
+		if ((byte & 0xf0) === 0x80) {
+			return this.map(byte & 0x0f);
+		}
+		if ((byte & 0xf0) === 0x90) {
+			return this.array(byte & 0x0f);
+		}
+		if ((byte & 0xe0) === 0xa0) {
+			return this.string(byte & 0x1f);
+		}
+
+		switch (byte) {
+			case 0xc0: return null;
+			case 0xc2: return false;
+			case 0xc3: return true;
+			case 0xc4: case 0xd9: return this.string(this.uint(1));
+			case 0xc5: case 0xda: return this.string(this.uint(2));
+			case 0xc6: case 0xdb: return this.string(this.uint(4));
+			case 0xca: return this.read(4, offset => this.buffer.readFloatBE(offset));
+			case 0xcb: return this.read(8, offset => this.buffer.readDoubleBE(offset));
+			case 0xcc: return this.uint(1);
+			case 0xcd: return this.uint(2);
+			case 0xce: return this.uint(4);
+			case 0xcf: return Number(this.read(8, offset => this.buffer.readBigUInt64BE(offset)));
+			case 0xd0: return this.read(1, offset => this.buffer.readInt8(offset));
+			case 0xd1: return this.read(2, offset => this.buffer.readInt16BE(offset));
+			case 0xd2: return this.read(4, offset => this.buffer.readInt32BE(offset));
+			case 0xd3: return Number(this.read(8, offset => this.buffer.readBigInt64BE(offset)));
+			case 0xdc: return this.array(this.uint(2));
+			case 0xdd: return this.array(this.uint(4));
+			case 0xde: return this.map(this.uint(2));
+			case 0xdf: return this.map(this.uint(4));
+			default: throw new Error(`Unsupported MessagePack type 0x${byte.toString(16)}`);
+		}
+	}
+
+	private map(count: number): Record<string, unknown> {
+		const result: Record<string, unknown> = {};
+		for (let i = 0; i < count; i++) {
+			const key = this.value();
+			if (typeof key !== 'string') {
+				throw new Error('MessagePack map key is not a string');
+			}
+			result[key] = this.value();
+		}
+		return result;
+	}
+
+	private array(count: number): unknown[] {
+		const result = new Array<unknown>(count);
+		for (let i = 0; i < count; i++) {
+			result[i] = this.value();
+		}
+		return result;
+	}
+
+	private string(size: number): string {
+		return this.read(size, offset => this.buffer.toString('utf8', offset, offset + size));
+	}
+
+	private uint(size: number): number {
+		return this.read(size, offset => this.buffer.readUIntBE(offset, size));
+	}
+
+	private read<T>(size: number, get: (offset: number) => T): T {
+		if (this.offset + size > this.buffer.length) {
+			throw new Error('Truncated MessagePack data');
+		}
+		const value = get(this.offset);
+		this.offset += size;
+		return value;
+	}
+}
+
+export function encode(value: unknown): Buffer {
+	const writer = new Writer();
+	writer.value(value);
+	return writer.finish();
+}
+
+/**
+ * Decode exactly one value; throws on malformed or trailing data.
+ */
+export function decode(buffer: Buffer): unknown {
+	const reader = new Reader(buffer);
+	const value = reader.value();
+	if (!reader.atEnd) {
+		throw new Error('Trailing bytes after MessagePack value');
+	}
+	return value;
+}